@@ -0,0 +1,214 @@
+//==============================================================================
+// AuricBlockDelay.h  (AURIC Ω76) — multichannel ring-buffer delay, block based
+//  - Storage sized once in prepare() (power-of-two ring, no allocation later)
+//  - Works on whole blocks with memcpy-style copies (no per-sample wrap test)
+//  - Used to keep the dry path aligned with latency-adding wet stages
+//  - rampDelay(): crossfade from the old tap to the new one (latency change
+//    lined up with another crossfade); glideDelay(): the tap itself slides
+//    there, interpolated (no comb between two taps); setDelay() jumps
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+class AuricBlockDelay
+{
+public:
+    AuricBlockDelay() = default;
+
+    void prepare (int numChannels, int maxDelaySamples, int maxBlockSize)
+    {
+        const int needed = juce::jmax (1, maxDelaySamples + maxBlockSize);
+        ringSize = juce::nextPowerOfTwo (needed);
+        ringMask = ringSize - 1;
+        maxDelay = juce::jmax (0, maxDelaySamples);
+        delay = juce::jmin (delay, maxDelay);   // re-prepare at a lower rate
+
+        ring.setSize (juce::jmax (1, numChannels), ringSize, false, true, false);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        ring.clear();
+        writePos = 0;
+        rampFrom = delay;
+        rampGain = 1.0f;
+        glidePos = (float) delay;
+    }
+
+    void setDelay (int samples) noexcept
+    {
+        delay = juce::jlimit (0, maxDelay, samples);
+        rampFrom = delay;
+        rampGain = 1.0f;
+        glidePos = (float) delay;
+    }
+
+    // Crossfades from the current tap to `samples` over setRampLength() samples.
+    // A ramp still running is cut short (its new tap becomes the old one).
+    void rampDelay (int samples) noexcept
+    {
+        samples = juce::jlimit (0, maxDelay, samples);
+        if (samples == delay)
+            return;
+
+        rampFrom = delay;
+        delay = samples;
+        rampGain = 0.0f;
+        glidePos = (float) delay;
+    }
+
+    // Slides the tap to `samples` at setGlideRate() samples per sample (pitch bends
+    // by that much while it moves); a new target mid-glide carries on from where it is.
+    void glideDelay (int samples) noexcept
+    {
+        if (rampGain < 1.0f)
+            glidePos = (float) delay;   // a crossfade still running: continue from its new tap
+
+        delay = juce::jlimit (0, maxDelay, samples);
+        rampFrom = delay;
+        rampGain = 1.0f;
+    }
+
+    void setRampLength (int samples) noexcept   { rampStep = 1.0f / (float) juce::jmax (1, samples); }
+    void setGlideRate (float rate) noexcept     { glideRate = juce::jmax (1.0e-3f, rate); }
+    bool isRamping() const noexcept             { return rampGain < 1.0f || glidePos != (float) delay; }
+
+    int  getDelay() const noexcept          { return delay; }   // target while ramping
+    int  getMaxDelay() const noexcept       { return maxDelay; }
+
+    // Writes the block into the ring and replaces it with the delayed signal.
+    void process (float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        jassert (numChannels <= ring.getNumChannels());
+        jassert (numSamples + juce::jmax (delay, rampFrom, (int) glidePos + 1) <= ringSize);
+
+        float g = rampGain;
+        float pos = glidePos;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            write (ch, channels[ch], numSamples);
+
+            if (glidePos != (float) delay)
+                pos = readGliding (ch, channels[ch], numSamples);
+            else if (rampGain < 1.0f)
+                g = readRamped (ch, channels[ch], numSamples);
+            else if (delay > 0)
+                read (ch, channels[ch], numSamples, delay);
+        }
+
+        rampGain = g;
+        glidePos = pos;
+        advance (numSamples);
+    }
+
+    // Keeps the history warm without producing output (comp-only wet delay while drive runs,
+    // so an A <-> D/Ω switch reads a continuous signal).
+    void push (const float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        jassert (numChannels <= ring.getNumChannels());
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            write (ch, channels[ch], numSamples);
+
+        // nothing read, the ramp / glide still run out on time
+        if (rampGain < 1.0f)
+            rampGain = juce::jmin (1.0f, rampGain + rampStep * (float) numSamples);
+
+        if (glidePos != (float) delay)
+        {
+            const float travel = glideRate * (float) numSamples;
+            glidePos = glidePos < (float) delay ? juce::jmin ((float) delay, glidePos + travel)
+                                                : juce::jmax ((float) delay, glidePos - travel);
+        }
+
+        advance (numSamples);
+    }
+
+    // The block last written (process / push), delayed by delaySamples: an extra tap
+    // on the same history, independent of getDelay().
+    void tap (int ch, float* dest, int numSamples, int delaySamples) const noexcept
+    {
+        jassert (numSamples + delaySamples <= ringSize);
+        read (ch, dest, numSamples, delaySamples + numSamples);
+    }
+
+private:
+    void write (int ch, const float* src, int numSamples) noexcept
+    {
+        auto* r = ring.getWritePointer (ch);
+        const int first = juce::jmin (numSamples, ringSize - writePos);
+
+        juce::FloatVectorOperations::copy (r + writePos, src, first);
+        if (first < numSamples)
+            juce::FloatVectorOperations::copy (r, src + first, numSamples - first);
+    }
+
+    void read (int ch, float* dest, int numSamples, int delaySamples) const noexcept
+    {
+        const auto* r = ring.getReadPointer (ch);
+        const int start = (writePos - delaySamples) & ringMask;
+        const int first = juce::jmin (numSamples, ringSize - start);
+
+        juce::FloatVectorOperations::copy (dest, r + start, first);
+        if (first < numSamples)
+            juce::FloatVectorOperations::copy (dest + first, r, numSamples - first);
+    }
+
+    // block just written, old tap -> new tap; returns the gain reached
+    float readRamped (int ch, float* dest, int numSamples) const noexcept
+    {
+        const auto* r = ring.getReadPointer (ch);
+        const int oldStart = writePos - rampFrom;
+        const int newStart = writePos - delay;
+        float g = rampGain;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            g = juce::jmin (1.0f, g + rampStep);
+            const float a = r[(oldStart + n) & ringMask];
+            dest[n] = a + g * (r[(newStart + n) & ringMask] - a);
+        }
+
+        return g;
+    }
+
+    // block just written, tap sliding towards `delay` (linear interpolation); returns where it got
+    float readGliding (int ch, float* dest, int numSamples) const noexcept
+    {
+        const auto* r = ring.getReadPointer (ch);
+        const float target = (float) delay;
+        float pos = glidePos;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            pos = pos < target ? juce::jmin (target, pos + glideRate) : juce::jmax (target, pos - glideRate);
+
+            const int whole = (int) pos;
+            const float frac = pos - (float) whole;
+            const int at = writePos + n - whole;
+            const float a = r[at & ringMask];
+            dest[n] = a + frac * (r[(at - 1) & ringMask] - a);
+        }
+
+        return pos;
+    }
+
+    void advance (int numSamples) noexcept { writePos = (writePos + numSamples) & ringMask; }
+
+    juce::AudioBuffer<float> ring;
+    int ringSize { 1 };
+    int ringMask { 0 };
+    int writePos { 0 };
+    int delay    { 0 };
+    int maxDelay { 0 };
+    int rampFrom { 0 };         // tap faded out while ramping
+    float rampGain { 1.0f };    // weight of `delay`, 0 -> 1
+    float rampStep { 1.0f };
+    float glidePos { 0.0f };    // tap while gliding (== delay when settled)
+    float glideRate { 1.0f / 32.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricBlockDelay)
+};
@@ -0,0 +1,1540 @@
+//==============================================================================
+// AuricCompressorEngine.cpp  (AURIC Ω76) — staged block compressor kernel
+//==============================================================================
+
+#include "AuricCompressorEngine.h"
+#include "AuricFastMath.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace
+{
+    using FVO = juce::FloatVectorOperations;
+
+    // detector floor (was linToDb (env + 1e-8))
+    static constexpr float envFloor = 1.0e-8f;
+
+    // release tail can park one ulp under 1.0 forever; snap so the idle path kicks in (~9e-6 dB)
+    static constexpr float gainSnap = 1.0e-6f;
+    // slow releases park further down than that ((ulp/2) / coeff); on silence it only
+    // shapes the next onset, so sleep accepts it (-0.09 dB worst)
+    static constexpr float sleepGainSlack = 1.0e-2f;
+
+    // parameter ramp length (zipper-free at any host buffer size)
+    static constexpr double rampSeconds = 0.02;
+
+    // lookahead tap glide, samples per sample: bends the pitch ~0.5 semitone while
+    // it moves (1 ms more lookahead takes 32 ms), exact in float steps
+    static constexpr float lookaheadGlideRate = 1.0f / 32.0f;
+
+    // settled parameter read through the same [] as a ramp
+    struct Settled
+    {
+        float v;
+        float operator[] (int) const noexcept { return v; }
+    };
+
+    // dest = src * (ramp or value)
+    inline void applyGain (float* dest, const float* src, const float* ramp, float value, int numSamples) noexcept
+    {
+        if (ramp != nullptr)
+            FVO::multiply (dest, src, ramp, numSamples);
+        else
+            FVO::multiply (dest, src, value, numSamples);
+    }
+
+    // one-pole tracker, different leak up/down; Rel = const float* (ramp) or Settled
+    template <bool TrackUp, typename Rel>
+    inline void onePoleStage (float* io, int numSamples, float& state, float atk, Rel rel, float& extreme) noexcept
+    {
+        float y = state;
+        float ext = extreme;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float x = io[n];
+            const bool attacking = TrackUp ? (x > y) : (x < y);
+            y += (attacking ? atk : rel[n]) * (x - y);
+            io[n] = y;
+            ext = TrackUp ? juce::jmax (ext, y) : juce::jmin (ext, y);
+        }
+
+        state = y;
+        extreme = ext;
+    }
+
+    // linked detector: mean of |x| over the sources (NumSrc 1 / 2 fixed, 0 = any)
+    template <int NumSrc>
+    inline void rectifyLinked (const float* const* src, int numSources, float* det, int numSamples) noexcept
+    {
+        if constexpr (NumSrc == 1)
+        {
+            juce::ignoreUnused (numSources);
+            FVO::abs (det, src[0], numSamples);
+        }
+        else if constexpr (NumSrc == 2)
+        {
+            // 0.5 * (|L| + |R|), one pass
+            juce::ignoreUnused (numSources);
+            for (int n = 0; n < numSamples; ++n)
+                det[n] = 0.5f * (std::abs (src[0][n]) + std::abs (src[1][n]));
+        }
+        else
+        {
+            // sum |x| source by source, then scale
+            FVO::abs (det, src[0], numSamples);
+
+            for (int ch = 1; ch < numSources; ++ch)
+                for (int n = 0; n < numSamples; ++n)
+                    det[n] += std::abs (src[ch][n]);
+
+            FVO::multiply (det, 1.0f / (float) numSources, numSamples);
+        }
+    }
+
+    using BandVec = juce::dsp::SIMDRegister<float>;
+    static constexpr int bandLanes = (int) BandVec::SIMDNumElements;
+    static_assert (bandLanes >= AuricCrossover::numBands, "one lane per band");
+
+    // one-pole leak over a 2^rateLog2-sample frame: 1 - (1 - leak)^frame (squared up in double,
+    // a small leak would lose most of its bits in 1 - leak as float)
+    inline float leakPerFrame (float leak, int rateLog2) noexcept
+    {
+        double keep = 1.0 - (double) leak;
+
+        for (int i = 0; i < rateLog2; ++i)
+            keep *= keep;
+
+        return (float) (1.0 - keep);
+    }
+
+    // peak under threshold on every channel (stops at the first loud one)
+    template <typename SampleType>
+    inline bool isSilent (const SampleType* const* channels, int numChannels, int numSamples) noexcept
+    {
+        const auto threshold = (SampleType) AuricCompressorEngine::sleepThreshold;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const auto range = FVO::findMinAndMax (channels[ch], numSamples);
+
+            if (range.getStart() <= -threshold || range.getEnd() >= threshold)
+                return false;
+        }
+
+        return true;
+    }
+
+    // multiband: every band a lane of one register -> one recursion for all of them
+    template <bool TrackUp, typename Rel>
+    inline void onePoleBandStage (float* frames, int numSamples, BandVec& state, float atk, Rel rel,
+                                  BandVec& extreme) noexcept
+    {
+        const BandVec a = BandVec::expand (atk);
+        BandVec y = state;
+        BandVec ext = extreme;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const BandVec x = BandVec::fromRawArray (frames + n * bandLanes);
+            const BandVec r = BandVec::expand (rel[n]);
+            const auto attacking = TrackUp ? BandVec::greaterThan (x, y) : BandVec::lessThan (x, y);
+
+            // select, not blend: each lane gets exactly atk or rel (one side is +0)
+            y += ((a & attacking) + (r & ~attacking)) * (x - y);
+            y.copyToRawArray (frames + n * bandLanes);
+            ext = TrackUp ? BandVec::max (ext, y) : BandVec::min (ext, y);
+        }
+
+        state = y;
+        extreme = ext;
+    }
+
+    // dual L/R or M/S: the two rows ride lanes 0 / 1 of the band recursion (spare lanes idle at 0)
+    template <bool TrackUp, typename Rel>
+    inline void bandPairStage (float* frames, float* io0, float* io1, int numSamples, float* state, float atk,
+                               Rel rel, float* extreme) noexcept
+    {
+        FVO::clear (frames, numSamples * bandLanes);
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            frames[n * bandLanes]     = io0[n];
+            frames[n * bandLanes + 1] = io1[n];
+        }
+
+        BandVec y = BandVec::expand (0.0f);
+        BandVec ext = BandVec::expand (0.0f);
+        y.set (0, state[0]);       y.set (1, state[1]);
+        ext.set (0, extreme[0]);   ext.set (1, extreme[1]);
+
+        onePoleBandStage<TrackUp> (frames, numSamples, y, atk, rel, ext);
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            io0[n] = frames[n * bandLanes];
+            io1[n] = frames[n * bandLanes + 1];
+        }
+
+        state[0] = y.get (0);      state[1] = y.get (1);
+        extreme[0] = ext.get (0);  extreme[1] = ext.get (1);
+    }
+}
+
+//==============================================================================
+void AuricCompressorEngine::prepare (double sampleRate, int numChannels)
+{
+    sr = sampleRate;
+    maxChunk = subBlockSize;   // host block size sizes nothing
+    numPrepared = juce::jlimit (1, maxChannels, numChannels);
+
+    // a stereo key still needs two filtered detector rows on a mono bus
+    const int numRowSets = juce::jmax (numPrepared, maxKeyChannels);
+    scratch.setSize (numSharedRows + numRowSets * numChannelRows, maxChunk, false, true, false);
+
+    for (int ch = 0; ch < numRowSets; ++ch)
+    {
+        const int base = numSharedRows + ch * numChannelRows;
+        xRows[ch]   = scratch.getWritePointer (base + rowX);
+        dRows[ch]   = scratch.getWritePointer (base + rowD);
+        wetRows[ch] = scratch.getWritePointer (base + rowWet);
+        ioRows[ch]  = scratch.getWritePointer (base + rowIo);
+
+        for (int b = 0; b < AuricCrossover::numBands; ++b)
+            bandRows[b][ch] = scratch.getWritePointer (base + rowLow + b);
+    }
+
+    bandFrames.allocate ((size_t) (2 * maxChunk * bandLanes) + BandVec::SIMDNumElements, true);   // + align slack
+    bandFrameData = BandVec::getNextSIMDAlignedPtr (bandFrames.get());
+
+    oversampler.prepare (numPrepared, maxChunk);
+
+    const int maxLatency = juce::jmax (oversampler.getMaxLatencySamples(),
+                                       AuricSaturator::AdaaAtan::getLatencySamples (2));
+    dryDelay.prepare (numPrepared, maxLatency, maxChunk);
+    wetDelay.prepare (numPrepared, maxLatency, maxChunk);
+
+    // the lookahead ring also gives the plain dry at the full latency (band split switch)
+    maxLookahead = (int) std::ceil (maxLookaheadSeconds * sr);
+    lookaheadDelay.prepare (numPrepared, maxLookahead + maxLatency, maxChunk);
+    for (auto& h : peakHold)
+        h.prepare (maxLookahead);
+    for (auto& r : rms)
+        r.prepare ((int) std::ceil (maxRmsWindowSeconds * sr));
+
+    sleepAfterSamples = (int) std::ceil (sleepAfterSeconds * sr);
+
+    // ~5 ms crossfades; tap ramps use the same step, so a dry ramp and the drive
+    // crossfade started on the same sample stay one crossfade of the whole output
+    const int switchSamples = juce::jmax (1, juce::roundToInt (0.005 * sr));
+    switchStep = 1.0f / (float) switchSamples;
+
+    for (auto* d : { &dryDelay, &wetDelay, &lookaheadDelay })
+        d->setRampLength (switchSamples);
+
+    lookaheadDelay.setGlideRate (lookaheadGlideRate);
+
+    for (auto* r : { &inGainRamp, &relLeakRamp, &driveRamp, &driveNormRamp, &mixRamp, &omegaMixRamp, &scFreqRamp,
+                     &xoverLowRamp, &xoverHighRamp })
+        r->prepare (sr, rampSeconds, maxChunk);
+
+    scFilter.prepare (sr, maxChunk);
+    crossover.prepare (sr, maxChunk);
+    detCrossover.prepare (sr, maxChunk);
+    reset();
+}
+
+void AuricCompressorEngine::reset() noexcept
+{
+    clearSignalState();
+
+    switchPending = false;
+    snapMode = true;
+    bandFade = 1.0f;
+
+    rampsPrimed = false;
+    gridPos = 0;
+
+    asleep = false;
+    silentSamples = 0;
+}
+
+void AuricCompressorEngine::clearSignalState() noexcept
+{
+    env[0] = env[1] = 0.0f;
+    gainLin[0] = gainLin[1] = 1.0f;
+
+    scFilter.reset();
+    scFilterLive = false;
+
+    crossover.reset();
+    detCrossover.reset();
+    crossoverLive = false;
+    detCrossoverLive = false;
+    bandEnv = BandVec::expand (0.0f);
+    bandGain = BandVec::expand (1.0f);
+    setControlRate (activeCtlLog2);
+
+    oversampler.reset();
+    dryDelay.reset();
+    wetDelay.reset();
+    lookaheadDelay.reset();
+    driveWasActive = false;
+    driveFade = 1.0f;
+
+    for (auto& h : peakHold)
+        h.reset();
+
+    for (auto& r : rms)
+        r.reset();
+
+    for (auto& a : adaa)
+        a.reset();
+
+    for (auto& a : adaaFade)
+        a.reset();
+}
+
+bool AuricCompressorEngine::canSleep() const noexcept
+{
+    // a release still running or a fade in flight would be cut short
+    for (float g : gainLin)
+        if (g < 1.0f - sleepGainSlack)
+            return false;
+
+    for (int b = 0; b < AuricCrossover::numBands; ++b)
+        if (bandGain.get ((size_t) b) < 1.0f - sleepGainSlack)
+            return false;
+
+    return ! switchPending && driveFade >= 1.0f && bandFade >= 1.0f
+        && ! dryDelay.isRamping() && ! wetDelay.isRamping() && ! lookaheadDelay.isRamping();
+}
+
+void AuricCompressorEngine::sleepBlock (int numSamples) noexcept
+{
+    // ramps land where they would have (targets were set for this block already)
+    for (auto* r : { &inGainRamp, &relLeakRamp, &driveRamp, &driveNormRamp, &mixRamp, &omegaMixRamp, &scFreqRamp,
+                     &xoverLowRamp, &xoverHighRamp })
+        r->advance (numSamples);
+
+    // nothing to fade: everything is silent already, swap right away
+    if (switchPending)
+        setOversampling (targetFactorLog2, targetPhase, targetAdaaOrder, targetLookahead, targetLatencyFloor);
+
+    gridPos = (gridPos + numSamples) & (subBlockSize - 1);
+}
+
+void AuricCompressorEngine::setOversampling (int factorLog2, int phase, int adaaOrderWanted, int lookahead,
+                                             int latencyFloor) noexcept
+{
+    oversampler.setMode (factorLog2, phase);
+
+    // ADAA only replaces oversampling, never stacks on it
+    const int newAdaa = (factorLog2 == 0 ? adaaOrderWanted : 0);
+    if (newAdaa != activeAdaaOrder)
+        for (auto& a : adaa)
+            a.reset();
+
+    activeAdaaOrder = newAdaa;
+
+    lookahead = juce::jlimit (0, maxLookahead, lookahead);
+    const int dryTap = getDryTapFor (factorLog2, phase, newAdaa, lookahead, latencyFloor);
+    dryDelay.setDelay (dryTap);
+    wetDelay.setDelay (dryTap);
+    drivePad = dryTap - getDriveLatency();
+    driveFade = 1.0f;
+
+    // the peak window starts empty (nothing is playing when this runs)
+    if (lookahead != lookaheadDelay.getDelay())
+    {
+        for (auto& h : peakHold)
+        {
+            h.setWindow (lookahead);
+            h.reset();
+        }
+    }
+
+    lookaheadDelay.setDelay (lookahead);
+
+    if (targetMultiband != activeMultiband)
+        setMultiband (targetMultiband);
+
+    bandFade = 1.0f;
+    switchPending = false;
+}
+
+void AuricCompressorEngine::requestOversampling (int factorLog2, int phase, int adaaOrderWanted, int lookahead,
+                                                 int latencyFloor) noexcept
+{
+    targetFactorLog2 = factorLog2;
+    targetPhase = phase;
+    targetAdaaOrder = adaaOrderWanted;
+    targetLookahead = juce::jlimit (0, maxLookahead, lookahead);
+    targetLatencyFloor = latencyFloor;
+
+    if (snapMode)
+    {
+        setOversampling (factorLog2, phase, adaaOrderWanted, lookahead, latencyFloor);
+        snapMode = false;
+        return;
+    }
+
+    // picked up at the next sub-block edge (startPendingSwitch)
+    switchPending = switchDiffers();
+}
+
+bool AuricCompressorEngine::switchDiffers() const noexcept
+{
+    const int newAdaa = (targetFactorLog2 == 0 ? targetAdaaOrder : 0);
+
+    return targetFactorLog2 != oversampler.getFactorLog2()
+        || (targetFactorLog2 > 0 && targetPhase != oversampler.getPhase())
+        || newAdaa != activeAdaaOrder
+        || getDryTapFor (targetFactorLog2, targetPhase, newAdaa, targetLookahead, targetLatencyFloor) != dryDelay.getDelay()
+        || targetLookahead != lookaheadDelay.getDelay()
+        || targetMultiband != activeMultiband;
+}
+
+void AuricCompressorEngine::startPendingSwitch() noexcept
+{
+    // lookahead: the audio tap glides, the detector window follows right away
+    if (targetLookahead != lookaheadDelay.getDelay())
+    {
+        lookaheadDelay.glideDelay (targetLookahead);
+
+        for (auto& h : peakHold)
+            h.setWindow (targetLookahead);
+    }
+
+    // drive variant / dry tap: one change at a time, the next waits for the crossfade
+    const int newAdaa = (targetFactorLog2 == 0 ? targetAdaaOrder : 0);
+    const int dryTap = getDryTapFor (targetFactorLog2, targetPhase, newAdaa, targetLookahead, targetLatencyFloor);
+    const bool sameVariant = (targetFactorLog2 == oversampler.getFactorLog2()
+                              && (targetFactorLog2 == 0 || targetPhase == oversampler.getPhase())
+                              && newAdaa == activeAdaaOrder);
+
+    if ((! sameVariant || dryTap != dryDelay.getDelay()) && driveFade >= 1.0f && ! dryDelay.isRamping())
+    {
+        fadeFactorLog2 = oversampler.getFactorLog2();
+        fadePhase = oversampler.getPhase();
+        fadeAdaaOrder = activeAdaaOrder;
+        fadePad = drivePad;
+        driveFadeDual = ! sameVariant;
+
+        // the old path carries on from its own state, the new one starts clean
+        if (newAdaa != activeAdaaOrder)
+        {
+            for (int ch = 0; ch < numPrepared; ++ch)
+            {
+                adaaFade[ch] = adaa[ch];
+                adaa[ch].reset();
+            }
+
+            activeAdaaOrder = newAdaa;
+        }
+
+        oversampler.setMode (targetFactorLog2, targetPhase);
+
+        // dry + comp-only taps ramp on the same samples as the drive crossfade
+        dryDelay.rampDelay (dryTap);
+        wetDelay.rampDelay (dryTap);
+        drivePad = dryTap - getDriveLatency();
+
+        // drive not running: nothing to crossfade from
+        driveFade = driveWasActive ? 0.0f : 1.0f;
+    }
+
+    switchPending = switchDiffers();
+}
+
+void AuricCompressorEngine::setMultiband (bool shouldSplit) noexcept
+{
+    // filters + the lanes of either layout start clean
+    activeMultiband = shouldSplit;
+    crossover.reset();
+    detCrossover.reset();
+    crossoverLive = false;
+    detCrossoverLive = false;
+    bandEnv = BandVec::expand (0.0f);
+    bandGain = BandVec::expand (1.0f);
+    env[0] = env[1] = 0.0f;
+    gainLin[0] = gainLin[1] = 1.0f;
+    setControlRate (activeCtlLog2);
+}
+
+int AuricCompressorEngine::getDryTapFor (int factorLog2, int phase, int adaaOrder, int lookahead,
+                                         int latencyFloor) const noexcept
+{
+    const int driveLatency = getLatencySamplesFor (factorLog2, phase, adaaOrder);
+    return juce::jlimit (driveLatency, dryDelay.getMaxDelay(), latencyFloor - lookahead);
+}
+
+void AuricCompressorEngine::applySwitchFade (float* const* channels, int numChannels, int numSamples, bool atGridEdge) noexcept
+{
+    const bool swapWanted = (targetMultiband != activeMultiband);
+
+    if (! swapWanted && bandFade >= 1.0f)
+        return;
+
+    // plain dry (trimmed input at the full latency) from the lookahead ring: the split's
+    // own dry is its band sum, this is the one both layouts agree on
+    const int tap = lookaheadDelay.getDelay() + dryDelay.getDelay();
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        lookaheadDelay.tap (ch, dRows[ch], numSamples, tap);
+
+    bandFade = crossfadeStage (channels, dRows, numChannels, numSamples, bandFade,
+                               swapWanted ? -switchStep : switchStep);
+
+    // swap on the sub-block grid only, so it lands on the same sample for any host block size
+    if (swapWanted && bandFade <= 0.0f && atGridEdge)
+        setMultiband (targetMultiband);
+}
+
+//==============================================================================
+template <typename SampleType>
+float* AuricCompressorEngine::loadSubBlock (SampleType* src, int ch, int numSamples) noexcept
+{
+    if constexpr (std::is_same_v<SampleType, float>)
+    {
+        juce::ignoreUnused (ch, numSamples);
+        return src;
+    }
+    else
+    {
+        auto* dest = ioRows[ch];
+        for (int n = 0; n < numSamples; ++n)
+            dest[n] = (float) src[n];
+        return dest;
+    }
+}
+
+template <typename SampleType>
+const float* AuricCompressorEngine::loadKeySubBlock (const SampleType* src, int ch, int numSamples) noexcept
+{
+    if constexpr (std::is_same_v<SampleType, float>)
+    {
+        juce::ignoreUnused (ch, numSamples);
+        return src;   // detector reads the host buffer directly
+    }
+    else
+    {
+        auto* dest = scratch.getWritePointer (bufKey0 + ch);
+        for (int n = 0; n < numSamples; ++n)
+            dest[n] = (float) src[n];
+        return dest;
+    }
+}
+
+template <typename SampleType>
+void AuricCompressorEngine::storeSubBlock (SampleType* dest, const float* src, int numSamples) noexcept
+{
+    if constexpr (std::is_same_v<SampleType, float>)
+        juce::ignoreUnused (dest, src, numSamples);   // processed in place
+    else
+        for (int n = 0; n < numSamples; ++n)
+            dest[n] = (SampleType) src[n];
+}
+
+template <typename SampleType>
+float AuricCompressorEngine::process (SampleType* const* channels, int numChannels, int numSamples, const Settings& s,
+                                      const SampleType* const* key, int numKeyChannels) noexcept
+{
+    jassert (maxChunk > 0);
+    jassert (numChannels >= 1 && numChannels <= numPrepared);
+    numChannels = juce::jlimit (1, numPrepared, numChannels);
+    numKey = (key != nullptr ? juce::jlimit (0, maxKeyChannels, numKeyChannels) : 0);
+
+    // the split changes the phase of everything: swapped at silence like a latency change
+    targetMultiband = s.multiband;
+    requestOversampling (s.osFactorLog2, s.osPhase, s.adaaOrder, s.lookahead, s.latencyFloor);
+    setRampTargets (s, numSamples);
+    targetCtlLog2 = controlRateLog2For (s.detEco);
+
+    // RMS ring only runs while used: starts from silence when it comes back
+    const int detMode = juce::jlimit (0, numDetModes - 1, s.detMode);
+    if (detMode != detPeak && activeDetMode == detPeak)
+        for (auto& r : rms)
+            r.reset();
+
+    activeDetMode = detMode;
+    for (auto& r : rms)
+        r.setWindow (s.rmsWindow);
+
+    // asleep + still silent: zeros out, no kernel
+    const bool silentIn = isSilent (channels, numChannels, numSamples)
+                       && (numKey == 0 || isSilent (key, numKey, numSamples));
+
+    if (asleep && silentIn)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            FVO::clear (channels[ch], numSamples);
+
+        sleepBlock (numSamples);
+        return 0.0f;
+    }
+
+    asleep = false;
+
+    // one dispatch per block (+ the multiband swap, which lands between sub-blocks);
+    // the kernels carry no routing / HPF / channel branches
+    const int routing = juce::jlimit (0, numRoutings - 1, s.routing);
+    const int layout = numChannels == 1 ? layoutMono
+                     : numChannels > 2  ? layoutMulti
+                     : s.scMode == scDualLR ? layoutDualLR
+                     : s.scMode == scDualMS ? layoutDualMS
+                     : layoutStereo;
+    const auto* kernels = chunkKernels[routing][s.scHpf ? 1 : 0];
+
+    float grPeakDb = 0.0f;
+    float* io[maxChannels];
+
+    // fixed sub-blocks on an absolute-time grid (not restarted per host call):
+    // working set stays in L1 and every chunk-level decision sees the same
+    // edges whatever the host block size -> same output for 7 or 4096 at a time
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int n = juce::jmin (subBlockSize - gridPos, numSamples - pos);
+
+        // detector rate changes where a frame of every size starts
+        if (gridPos == 0 && targetCtlLog2 != activeCtlLog2)
+            setControlRate (targetCtlLog2);
+
+        if (gridPos == 0 && switchPending)
+            startPendingSwitch();
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            io[ch] = loadSubBlock (channels[ch] + pos, ch, n);
+
+        for (int ch = 0; ch < numKey; ++ch)
+            keyRows[ch] = loadKeySubBlock (key[ch] + pos, ch, n);
+
+        // SC filter / crossover: one coefficient set per sub-block (tan() at control rate only)
+        scFilter.setTarget (scFreqRamp.advance (n), s.scShape);
+
+        // first sub-block after a reset / clear: start right on this cutoff + shape
+        // (a glide from the default would span however long the host's first chunk is)
+        if (! scFilterLive)
+        {
+            scFilter.reset();
+            scFilterLive = true;
+        }
+
+        const float xoverLow = xoverLowRamp.advance (n);
+        const float xoverHigh = xoverHighRamp.advance (n);
+
+        if (activeMultiband)
+        {
+            crossover.setTargets (xoverLow, xoverHigh);
+            detCrossover.setTargets (xoverLow, xoverHigh);
+
+            // split just switched on / cleared: start right on these cutoffs
+            if (! crossoverLive)
+            {
+                crossover.reset();
+                crossoverLive = true;
+            }
+        }
+
+        const auto kernel = kernels[activeMultiband ? layoutMultiband : layout];
+        grPeakDb = juce::jmax (grPeakDb, (this->*kernel) (io, numChannels, n, s));
+
+        gridPos = (gridPos + n) & (subBlockSize - 1);
+
+        if (gridPos == 0)
+        {
+            for (auto& g : gainLin)
+                g = (g > 1.0f - gainSnap ? 1.0f : g);
+
+            for (int b = 0; b < AuricCrossover::numBands; ++b)
+                if (bandGain.get ((size_t) b) > 1.0f - gainSnap)
+                    bandGain.set ((size_t) b, 1.0f);
+        }
+
+        applySwitchFade (io, numChannels, n, gridPos == 0);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            storeSubBlock (channels[ch] + pos, io[ch], n);
+
+        pos += n;
+    }
+
+    // long enough under the threshold (tails through the latency included) and the
+    // output itself silent: clear down to the silent state and skip from the next block
+    silentSamples = silentIn ? juce::jmin (silentSamples + numSamples, 1 << 30) : 0;
+
+    if (silentSamples >= sleepAfterSamples + getLatencySamples() && canSleep()
+         && isSilent (channels, numChannels, numSamples))
+    {
+        clearSignalState();
+        asleep = true;
+    }
+
+    return grPeakDb;
+}
+
+template <typename SampleType>
+void AuricCompressorEngine::processBypassed (SampleType* const* channels, int numChannels, int numSamples,
+                                             int osFactorLog2, int osPhase, int adaaOrder, int lookahead,
+                                             int latencyFloor) noexcept
+{
+    jassert (numChannels >= 1 && numChannels <= numPrepared);
+    numChannels = juce::jlimit (1, numPrepared, numChannels);
+
+    requestOversampling (osFactorLog2, osPhase, adaaOrder, lookahead, latencyFloor);
+
+    float* io[maxChannels];
+
+    // the delays carry the input again
+    asleep = false;
+    silentSamples = 0;
+
+    // dry delay is already sized for the largest latency; keep host PDC honest
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int n = juce::jmin (subBlockSize - gridPos, numSamples - pos);
+
+        // taps ramp as usual; the drive and band split aren't heard here, they just swap
+        if (gridPos == 0 && switchPending)
+        {
+            startPendingSwitch();
+
+            if (targetMultiband != activeMultiband)
+                setMultiband (targetMultiband);
+
+            switchPending = switchDiffers();
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            io[ch] = loadSubBlock (channels[ch] + pos, ch, n);
+
+        lookaheadDelay.process (io, numChannels, n);
+
+        dryDelay.process (io, numChannels, n);
+
+        gridPos = (gridPos + n) & (subBlockSize - 1);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            storeSubBlock (channels[ch] + pos, io[ch], n);
+
+        pos += n;
+    }
+
+    env[0] = env[1] = 0.0f;
+    gainLin[0] = gainLin[1] = 1.0f;
+    bandEnv = BandVec::expand (0.0f);
+    bandGain = BandVec::expand (1.0f);
+    driveWasActive = false;
+    driveFade = 1.0f;
+    bandFade = 1.0f;
+    rampsPrimed = false;
+
+    for (auto& a : adaa)
+        a.reset();
+}
+
+template float AuricCompressorEngine::process<float>  (float* const*,  int, int, const Settings&, const float* const*,  int) noexcept;
+template float AuricCompressorEngine::process<double> (double* const*, int, int, const Settings&, const double* const*, int) noexcept;
+template void AuricCompressorEngine::processBypassed<float>  (float* const*,  int, int, int, int, int, int, int) noexcept;
+template void AuricCompressorEngine::processBypassed<double> (double* const*, int, int, int, int, int, int, int) noexcept;
+
+void AuricCompressorEngine::setRampTargets (const Settings& s, int numSamples) noexcept
+{
+    // drive in = k (MODE * Ω boost * EDGE), drive out = 1 / atan(hard) of the requested shaper
+    // (not the running one: that swaps on the grid, the ramp would start a host block late)
+    const bool adaaWanted = (s.osFactorLog2 == 0 && s.adaaOrder > 0);
+    const int approx = adaaWanted ? AuricSaturator::atanExact
+                                  : AuricSaturator::approxFor (s.omegaMode, s.satEco);
+    const float driveK = s.driveBase * AuricSaturator::driveBoostFor (s.omegaMode) * s.hard;
+    const float driveNorm = AuricSaturator::normFor (approx, s.hard);
+
+    if (! rampsPrimed)
+    {
+        inGainRamp.reset (s.inGain);
+        relLeakRamp.reset (s.relLeak);
+        driveRamp.reset (driveK);
+        driveNormRamp.reset (driveNorm);
+        mixRamp.reset (s.mix);
+        omegaMixRamp.reset (s.omegaMix);
+        scFreqRamp.reset (s.scFreq);
+        xoverLowRamp.reset (s.xoverLow);
+        xoverHighRamp.reset (s.xoverHigh);
+        rampsPrimed = true;
+        return;
+    }
+
+    // the block's value belongs to its end: long host buffers glide over the whole block
+    inGainRamp.setTarget (s.inGain, numSamples);
+    relLeakRamp.setTarget (s.relLeak, numSamples);
+    driveRamp.setTarget (driveK, numSamples);
+    driveNormRamp.setTarget (driveNorm, numSamples);
+    mixRamp.setTarget (s.mix, numSamples);
+    omegaMixRamp.setTarget (s.omegaMix, numSamples);
+    scFreqRamp.setTarget (s.scFreq, numSamples);
+    xoverLowRamp.setTarget (s.xoverLow, numSamples);
+    xoverHighRamp.setTarget (s.xoverHigh, numSamples);
+}
+
+//==============================================================================
+// routing x SC HPF x layout, resolved once per block (see chunkKernels);
+// multiband has no SC filter (each band is its own detector EQ), both columns share it
+const AuricCompressorEngine::ChunkKernel AuricCompressorEngine::chunkKernels[numRoutings][2][numLayouts] =
+{
+    { { &AuricCompressorEngine::processChunk<routingA, false, layoutMono>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutMultiband> },
+      { &AuricCompressorEngine::processChunk<routingA, true,  layoutMono>,
+        &AuricCompressorEngine::processChunk<routingA, true,  layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingA, true,  layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingA, true,  layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingA, true,  layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingA, false, layoutMultiband> } },
+    { { &AuricCompressorEngine::processChunk<routingD, false, layoutMono>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutMultiband> },
+      { &AuricCompressorEngine::processChunk<routingD, true,  layoutMono>,
+        &AuricCompressorEngine::processChunk<routingD, true,  layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingD, true,  layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingD, true,  layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingD, true,  layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingD, false, layoutMultiband> } },
+    { { &AuricCompressorEngine::processChunk<routingOmega, false, layoutMono>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutMultiband> },
+      { &AuricCompressorEngine::processChunk<routingOmega, true,  layoutMono>,
+        &AuricCompressorEngine::processChunk<routingOmega, true,  layoutStereo>,
+        &AuricCompressorEngine::processChunk<routingOmega, true,  layoutMulti>,
+        &AuricCompressorEngine::processChunk<routingOmega, true,  layoutDualLR>,
+        &AuricCompressorEngine::processChunk<routingOmega, true,  layoutDualMS>,
+        &AuricCompressorEngine::processChunk<routingOmega, false, layoutMultiband> } }
+};
+
+template <int Routing, bool ScHpf, int Layout>
+float AuricCompressorEngine::processChunk (float* const* io, int numChannels, int numSamples, const Settings& s) noexcept
+{
+    constexpr bool useComp  = (Routing != routingD);
+    constexpr bool useDrive = (Routing != routingA);
+    constexpr bool dual     = (Layout == layoutDualLR || Layout == layoutDualMS);
+    constexpr bool bands    = (Layout == layoutMultiband);
+    constexpr int  NumCh    = (Layout == layoutMono ? 1 : (Layout == layoutMulti || bands) ? 0 : 2);
+    const int numCh = (NumCh > 0 ? NumCh : numChannels);   // constant for mono / stereo
+
+    auto* envB  = scratch.getWritePointer (bufEnv);
+    auto* gain  = scratch.getWritePointer (bufGain);
+    auto* envB2 = scratch.getWritePointer (bufEnv2);
+    auto* gain2 = scratch.getWritePointer (bufGain2);
+    auto* envB3 = scratch.getWritePointer (bufEnv3);
+    auto* gain3 = scratch.getWritePointer (bufGain3);
+
+    float* const* dryChans = xRows;
+    float* const* wetChans = wetRows;
+
+    // 0) parameter ramps for this chunk (nullptr = settled -> scalar getValue())
+    const float* inGainR    = inGainRamp.next (numSamples);
+    const float* relR       = relLeakRamp.next (numSamples);
+    const float* driveR     = driveRamp.next (numSamples);
+    const float* driveNormR = driveNormRamp.next (numSamples);
+    const float* mixR       = mixRamp.next (numSamples);
+    const float* omegaMixR  = omegaMixRamp.next (numSamples);
+
+    // 1) trim
+    for (int ch = 0; ch < numCh; ++ch)
+        applyGain (dryChans[ch], io[ch], inGainR, inGainRamp.getValue(), numSamples);
+
+    // 2) detector (input or external key) -> envelope, 3) gain computer -> smoothed gain
+    // (also runs for D: keeps the GR meter + state live)
+    jassert (s.curve != nullptr);
+    float minGain = 1.0f;
+    bool bandsReady = false;   // multiband: audio bands already split (shared with the detector)
+
+    // control rate: gain computer + smoother see the envelope's peak once per frame
+    // (the envelope itself stays at audio rate: a peak-held |x| would read averaging
+    // attacks several dB hot on dense material)
+    const bool ctlRate = (activeCtlLog2 > 0);
+    const int numCtl = ctlRate ? controlFrameCount (numSamples) : numSamples;
+    const float gainAtk = ctlRate ? leakPerFrame (s.atkLeak, activeCtlLog2) : s.atkLeak;
+    const float* gainRel = ctlRate ? controlReleaseStage (relR, numSamples) : relR;
+
+    if constexpr (bands)
+    {
+        float* const bandEnvs[AuricCrossover::numBands]  = { envB, envB2, envB3 };
+        float* const bandGains[AuricCrossover::numBands] = { gain, gain2, gain3 };
+
+        bandsReady = bandDetectorStage (numCh, bandEnvs, numSamples);
+
+        for (int b = 0; b < AuricCrossover::numBands; ++b)
+        {
+            if (numKey > 0)
+                applyGain (bandEnvs[b], bandEnvs[b], inGainR, inGainRamp.getValue(), numSamples);
+
+            detectorShapeStage (bandEnvs[b], bandGains[b], b, numSamples);
+            peakHold[b].process (bandEnvs[b], numSamples);
+        }
+
+        minGain = bandGainStage (bandEnvs, bandGains, numSamples, s.atkLeak, relR, gainAtk, gainRel, *s.curve);
+    }
+    else if constexpr (dual)
+    {
+        detectorPairStage<ScHpf, Layout == layoutDualMS> (envB, envB2, s.scLink, numSamples);
+
+        // external key: INPUT still sets how hard it drives the comp (|g x| = g |x|)
+        if (numKey > 0)
+        {
+            applyGain (envB,  envB,  inGainR, inGainRamp.getValue(), numSamples);
+            applyGain (envB2, envB2, inGainR, inGainRamp.getValue(), numSamples);
+        }
+
+        detectorShapeStage (envB,  gain,  0, numSamples);
+        detectorShapeStage (envB2, gain2, 1, numSamples);
+
+        peakHold[0].process (envB,  numSamples);
+        peakHold[1].process (envB2, numSamples);
+
+        float envPeak[2];
+        envelopePairStage (envB, envB2, numSamples, s.atkLeak, relR, envPeak);
+
+        if (ctlRate)
+        {
+            decimateStage (envB,  0, numSamples);
+            decimateStage (envB2, 1, numSamples);
+        }
+
+        float* const laneEnv[2]  = { envB, envB2 };
+        float* const laneGain[2] = { gain, gain2 };
+        bool settled = true;
+
+        for (int lane = 0; lane < 2; ++lane)
+        {
+            if (envPeak[lane] + envFloor <= s.curve->idleBelow)
+            {
+                FVO::fill (laneGain[lane], 1.0f, numCtl);
+                settled = settled && gainLin[lane] >= 1.0f;
+            }
+            else
+            {
+                gainComputerStage (laneEnv[lane], laneGain[lane], numCtl, *s.curve);
+                settled = false;
+            }
+        }
+
+        if (! settled)
+            minGain = gainSmootherPairStage (gain, gain2, numCtl, gainAtk, gainRel);
+
+        if (ctlRate)
+        {
+            interpolateStage (gain,  0, numSamples);
+            interpolateStage (gain2, 1, numSamples);
+        }
+    }
+    else
+    {
+        detectorStage<ScHpf, NumCh> (numCh, envB, numSamples);
+
+        if (numKey > 0)
+            applyGain (envB, envB, inGainR, inGainRamp.getValue(), numSamples);
+
+        detectorShapeStage (envB, gain, 0, numSamples);
+
+        peakHold[0].process (envB, numSamples);
+
+        const float envPeak = envelopeStage (envB, numSamples, s.atkLeak, relR);
+
+        if (ctlRate)
+            decimateStage (envB, 0, numSamples);
+
+        const bool idle = (envPeak + envFloor <= s.curve->idleBelow);
+
+        if (! idle)
+        {
+            gainComputerStage (envB, gain, numCtl, *s.curve);
+            minGain = gainSmootherStage (gain, numCtl, gainAtk, gainRel);
+        }
+        else
+        {
+            // under threshold the whole chunk: target is unity, only a release tail can be left
+            FVO::fill (gain, 1.0f, numCtl);
+
+            if (gainLin[0] < 1.0f)
+                minGain = gainSmootherStage (gain, numCtl, gainAtk, gainRel);
+        }
+
+        if (ctlRate)
+            interpolateStage (gain, 0, numSamples);
+
+        // lane 1 follows, so switching to L/R or M/S carries on from here
+        env[1] = env[0];
+        gainLin[1] = gainLin[0];
+        ctlPeak[1] = ctlPeak[0];
+        ctlFrom[1] = ctlFrom[0];
+        ctlTo[1] = ctlTo[0];
+    }
+
+    // lookahead: audio arrives `lookahead` samples after the detector saw it
+    // (at 0 this only writes the ring: one copy per channel)
+    lookaheadDelay.process (dryChans, numCh, numSamples);
+
+    // 4) apply / drive
+    if constexpr (bands)
+    {
+        const auto* low  = bandRows[AuricCrossover::bandLow];
+        const auto* mid  = bandRows[AuricCrossover::bandMid];
+        const auto* high = bandRows[AuricCrossover::bandHigh];
+
+        // audio bands come after the lookahead delay (unless the detector's split is the same)
+        if (! bandsReady)
+            crossover.process (dryChans, low, mid, high, numCh, numSamples);
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            // dry = plain band sum: same all-pass phase as the wet, so mix / Ω don't comb
+            FVO::add (dryChans[ch], low[ch], mid[ch], numSamples);
+            FVO::add (dryChans[ch], high[ch], numSamples);
+
+            if constexpr (useComp)
+            {
+                FVO::multiply (wetChans[ch], low[ch], gain, numSamples);
+                FVO::addWithMultiply (wetChans[ch], mid[ch], gain2, numSamples);
+                FVO::addWithMultiply (wetChans[ch], high[ch], gain3, numSamples);
+            }
+            else
+            {
+                FVO::copy (wetChans[ch], dryChans[ch], numSamples);
+            }
+        }
+    }
+    else if constexpr (useComp && Layout == layoutDualMS)
+    {
+        // gains act on mid / side, straight back to L/R (drive + mix stay L/R)
+        const float* xL = dryChans[0];
+        const float* xR = dryChans[1];
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float m  = 0.5f * (xL[n] + xR[n]) * gain[n];
+            const float sd = 0.5f * (xL[n] - xR[n]) * gain2[n];
+            wetChans[0][n] = m + sd;
+            wetChans[1][n] = m - sd;
+        }
+    }
+    else
+    {
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            if constexpr (useComp)
+                FVO::multiply (wetChans[ch], dryChans[ch], (dual && ch == 1) ? gain2 : gain, numSamples);
+            else
+                FVO::copy (wetChans[ch], dryChans[ch], numSamples);
+        }
+    }
+
+    if constexpr (useDrive)
+    {
+        if (! driveWasActive)
+        {
+            oversampler.reset();
+            for (auto& a : adaa)
+                a.reset();
+
+            driveFade = 1.0f;
+        }
+
+        // the pad ahead of the drive is a tap on the wet ring; fed either way,
+        // so A <-> D/Ω switches stay continuous
+        wetDelay.push (wetChans, numCh, numSamples);
+
+        const int approx = AuricSaturator::approxFor (s.omegaMode, s.satEco);
+        const bool fading = (driveFade < 1.0f);
+
+        // the old path goes through the detector rows (free by now)
+        float* const* oldChans = dRows;
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            if (fading)
+                wetDelay.tap (ch, oldChans[ch], numSamples, fadePad);
+
+            if (drivePad > 0)
+                wetDelay.tap (ch, wetChans[ch], numSamples, drivePad);
+        }
+
+        // same variant, only the pad moved: crossfade the taps going in
+        if (fading && ! driveFadeDual)
+            driveFade = crossfadeStage (wetChans, oldChans, numCh, numSamples, driveFade, switchStep);
+
+        driveStage (wetChans, numCh, numSamples, oversampler.getFactorLog2(), oversampler.getPhase(),
+                    activeAdaaOrder, adaa, approx, driveR, driveNormR);
+
+        // new variant: the old one keeps running until it's crossfaded out
+        if (fading && driveFadeDual)
+        {
+            driveStage (oldChans, numCh, numSamples, fadeFactorLog2, fadePhase, fadeAdaaOrder, adaaFade,
+                        approx, driveR, driveNormR);
+            driveFade = crossfadeStage (wetChans, oldChans, numCh, numSamples, driveFade, switchStep);
+        }
+    }
+    else
+    {
+        // comp only: linear, no need to oversample, just match the latency
+        wetDelay.process (wetChans, numCh, numSamples);
+    }
+
+    driveWasActive = useDrive;
+
+    // dry path aligned with whatever the wet path added
+    dryDelay.process (dryChans, numCh, numSamples);
+
+    for (int ch = 0; ch < numCh; ++ch)
+    {
+        // Ω = comp -> drive, blended against the trimmed input
+        if constexpr (Routing == routingOmega)
+            blendStage (wetChans[ch], dryChans[ch], wetChans[ch], omegaMixR, omegaMixRamp.getValue(), numSamples);
+
+        // 5) wet/dry
+        blendStage (io[ch], dryChans[ch], wetChans[ch], mixR, mixRamp.getValue(), numSamples);
+    }
+
+    // max GR over the chunk == GR at the smallest gain (one log per chunk, not per sample)
+    return minGain < 1.0f ? -AuricFastMath::fastLog2 (minGain) * AuricFastMath::dbPerLog2 : 0.0f;
+}
+
+//==============================================================================
+template <bool ScHpf>
+const float* const* AuricCompressorEngine::sidechainSourceStage (const float* const* source, int numSources,
+                                                                 int numSamples) noexcept
+{
+    if constexpr (ScHpf)
+    {
+        scFilter.process (source, dRows, numSources, numSamples);
+        return dRows;
+    }
+    else
+    {
+        juce::ignoreUnused (numSources, numSamples);
+        return source;
+    }
+}
+
+template <bool ScHpf, int NumCh>
+void AuricCompressorEngine::detectorStage (int numChannels, float* det, int numSamples) noexcept
+{
+    // external key has its own width (mono / stereo), whatever the bus is
+    if (numKey > 0)
+    {
+        const auto* key = sidechainSourceStage<ScHpf> (keyRows, numKey, numSamples);
+
+        if (numKey == 1)
+            rectifyLinked<1> (key, 1, det, numSamples);
+        else
+            rectifyLinked<2> (key, 2, det, numSamples);
+
+        return;
+    }
+
+    const auto* src = sidechainSourceStage<ScHpf> (xRows, numChannels, numSamples);
+    rectifyLinked<NumCh> (src, numChannels, det, numSamples);
+}
+
+template <bool ScHpf, bool MidSide>
+void AuricCompressorEngine::detectorPairStage (float* det0, float* det1, float link, int numSamples) noexcept
+{
+    // mono key feeds both lanes
+    const int numSources = (numKey > 0 ? numKey : 2);
+    const auto* src = sidechainSourceStage<ScHpf> (numKey > 0 ? keyRows : xRows, numSources, numSamples);
+    const float* s0 = src[0];
+    const float* s1 = src[numSources - 1];
+
+    // each lane pulled towards the linked mean by `link` (no extra recursion)
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const float a = MidSide ? std::abs (0.5f * (s0[n] + s1[n])) : std::abs (s0[n]);
+        const float b = MidSide ? std::abs (0.5f * (s0[n] - s1[n])) : std::abs (s1[n]);
+        const float mean = 0.5f * (a + b);
+
+        det0[n] = a + link * (mean - a);
+        det1[n] = b + link * (mean - b);
+    }
+}
+
+bool AuricCompressorEngine::bandDetectorStage (int numChannels, float* const* det, int numSamples) noexcept
+{
+    // no key, no lookahead: the detector sees exactly the audio bands -> split once
+    const bool shared = (numKey == 0 && lookaheadDelay.getDelay() == 0 && ! lookaheadDelay.isRamping());
+    const int numSources = (numKey > 0 ? numKey : numChannels);
+    const float* const* src = (numKey > 0 ? keyRows : xRows);
+
+    const auto* low  = bandRows[AuricCrossover::bandLow];
+    const auto* mid  = bandRows[AuricCrossover::bandMid];
+    const auto* high = bandRows[AuricCrossover::bandHigh];
+
+    if (shared)
+    {
+        crossover.process (src, low, mid, high, numSources, numSamples);
+    }
+    else
+    {
+        // own split for the undelayed input / the key; clean start when it comes back
+        if (! detCrossoverLive)
+            detCrossover.reset();
+
+        detCrossover.process (src, low, mid, high, numSources, numSamples);
+    }
+
+    detCrossoverLive = ! shared;
+
+    // linked per band (mean |x| over the channels)
+    for (int b = 0; b < AuricCrossover::numBands; ++b)
+    {
+        if (numSources == 1)
+            rectifyLinked<1> (bandRows[b], 1, det[b], numSamples);
+        else if (numSources == 2)
+            rectifyLinked<2> (bandRows[b], 2, det[b], numSamples);
+        else
+            rectifyLinked<0> (bandRows[b], numSources, det[b], numSamples);
+    }
+
+    return shared;
+}
+
+float AuricCompressorEngine::bandGainStage (const float* const* det, float* const* gains, int numSamples, float atk,
+                                            const float* rel, float gainAtk, const float* gainRel,
+                                            const AuricGainCurve::Table& curve) noexcept
+{
+    auto* envF  = bandFrameData;
+    auto* gainF = envF + maxChunk * bandLanes;
+    const int numValues = numSamples * bandLanes;
+
+    // band rows -> one register per sample; spare lanes stay 0 (= idle, gain 1)
+    FVO::clear (envF, numValues);
+
+    for (int b = 0; b < AuricCrossover::numBands; ++b)
+        for (int n = 0; n < numSamples; ++n)
+            envF[n * bandLanes + b] = det[b][n];
+
+    BandVec envPeaks = BandVec::expand (0.0f);
+
+    if (rel != nullptr)
+        onePoleBandStage<true> (envF, numSamples, bandEnv, atk, rel, envPeaks);
+    else
+        onePoleBandStage<true> (envF, numSamples, bandEnv, atk, Settled { relLeakRamp.getValue() }, envPeaks);
+
+    // control rate: each band's envelope peak per frame, packed down in place
+    int numCtl = numSamples;
+
+    if (activeCtlLog2 > 0)
+    {
+        const int frameMask = (1 << activeCtlLog2) - 1;
+        BandVec peak = BandVec::expand (0.0f);
+
+        for (int b = 0; b < AuricCrossover::numBands; ++b)
+            peak.set ((size_t) b, ctlPeak[b]);
+
+        numCtl = 0;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            peak = BandVec::max (peak, BandVec::fromRawArray (envF + n * bandLanes));
+
+            if (((gridPos + n + 1) & frameMask) == 0)
+            {
+                peak.copyToRawArray (envF + numCtl++ * bandLanes);
+                peak = BandVec::expand (0.0f);
+            }
+        }
+
+        for (int b = 0; b < AuricCrossover::numBands; ++b)
+            ctlPeak[b] = peak.get ((size_t) b);
+    }
+
+    const int numCtlValues = numCtl * bandLanes;
+    float envPeak = 0.0f;
+    bool released = true;
+
+    for (int b = 0; b < AuricCrossover::numBands; ++b)
+    {
+        envPeak = juce::jmax (envPeak, envPeaks.get ((size_t) b));
+        released = released && bandGain.get ((size_t) b) >= 1.0f;
+    }
+
+    // all bands under threshold: unity target, only a release tail can be left
+    const bool idle = (envPeak + envFloor <= curve.idleBelow);
+
+    // gain computer is elementwise: the frames go through it as one long array
+    if (idle)
+        FVO::fill (gainF, 1.0f, numCtlValues);
+    else
+        gainComputerStage (envF, gainF, numCtlValues, curve);
+
+    BandVec gainMins = BandVec::expand (1.0f);
+
+    if (! idle || ! released)
+    {
+        if (gainRel != nullptr)
+            onePoleBandStage<false> (gainF, numCtl, bandGain, gainAtk, gainRel, gainMins);
+        else
+            onePoleBandStage<false> (gainF, numCtl, bandGain, gainAtk, Settled { relLeakRamp.getValue() }, gainMins);
+    }
+
+    float minGain = 1.0f;
+
+    for (int b = 0; b < AuricCrossover::numBands; ++b)
+    {
+        minGain = juce::jmin (minGain, gainMins.get ((size_t) b));
+
+        for (int n = 0; n < numCtl; ++n)
+            gains[b][n] = gainF[n * bandLanes + b];
+
+        if (activeCtlLog2 > 0)
+            interpolateStage (gains[b], b, numSamples);
+    }
+
+    return minGain;
+}
+
+int AuricCompressorEngine::controlRateLog2For (bool eco) const noexcept
+{
+    // above 96 kHz: frames bring the detector back to 44.1 / 48 kHz (4 at 176.4 / 192k, 8 at 352.8 / 384k)
+    int rateLog2 = 0;
+
+    if (autoControlRate && sr > fullRateDetectorMaxHz)
+        while (rateLog2 < maxControlRateLog2 && sr / (double) (2 << rateLog2) >= 44100.0)
+            ++rateLog2;
+
+    // eco: one step further, at least 4 samples a frame
+    return eco ? juce::jlimit (2, maxControlRateLog2, rateLog2 + 1) : rateLog2;
+}
+
+void AuricCompressorEngine::setControlRate (int rateLog2) noexcept
+{
+    activeCtlLog2 = rateLog2;
+
+    // nothing half-collected, interpolation starts from wherever the gain is
+    for (int lane = 0; lane < AuricCrossover::numBands; ++lane)
+    {
+        ctlPeak[lane] = 0.0f;
+        ctlFrom[lane] = ctlTo[lane] = activeMultiband ? bandGain.get ((size_t) lane) : gainLin[juce::jmin (lane, 1)];
+    }
+}
+
+int AuricCompressorEngine::controlFrameCount (int numSamples) const noexcept
+{
+    // frames ending inside [gridPos, gridPos + numSamples)
+    return ((gridPos + numSamples) >> activeCtlLog2) - (gridPos >> activeCtlLog2);
+}
+
+const float* AuricCompressorEngine::controlReleaseStage (const float* rel, int numSamples) noexcept
+{
+    if (rel == nullptr)
+    {
+        FVO::fill (ctlRel, leakPerFrame (relLeakRamp.getValue(), activeCtlLog2), controlFrameCount (numSamples));
+        return ctlRel;
+    }
+
+    // ramping: the value at each frame's last sample
+    const int frameMask = (1 << activeCtlLog2) - 1;
+    int numFrames = 0;
+
+    for (int n = 0; n < numSamples; ++n)
+        if (((gridPos + n + 1) & frameMask) == 0)
+            ctlRel[numFrames++] = leakPerFrame (rel[n], activeCtlLog2);
+
+    return ctlRel;
+}
+
+void AuricCompressorEngine::decimateStage (float* det, int lane, int numSamples) noexcept
+{
+    // envelope peak over each frame (an attack inside it is never missed), in place
+    const int frameMask = (1 << activeCtlLog2) - 1;
+    float peak = ctlPeak[lane];
+    int numFrames = 0;
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        peak = juce::jmax (peak, det[n]);
+
+        if (((gridPos + n + 1) & frameMask) == 0)
+        {
+            det[numFrames++] = peak;
+            peak = 0.0f;
+        }
+    }
+
+    ctlPeak[lane] = peak;
+}
+
+void AuricCompressorEngine::interpolateStage (float* gains, int lane, int numSamples) noexcept
+{
+    // one gain per finished frame in -> audio rate out: linear from the previous
+    // frame's gain to the last one over the next frame (one frame of lag)
+    const int frameSize = 1 << activeCtlLog2;
+    const float step = 1.0f / (float) frameSize;
+
+    float ctl[subBlockSize];
+    FVO::copy (ctl, gains, controlFrameCount (numSamples));
+
+    float from = ctlFrom[lane];
+    float to = ctlTo[lane];
+    int phase = gridPos & (frameSize - 1);
+    int k = 0;
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        gains[n] = from + (to - from) * (float) ++phase * step;
+
+        if (phase == frameSize)
+        {
+            from = to;
+            to = ctl[k++];
+            phase = 0;
+        }
+    }
+
+    ctlFrom[lane] = from;
+    ctlTo[lane] = to;
+}
+
+void AuricCompressorEngine::detectorShapeStage (float* det, float* tmp, int lane, int numSamples) noexcept
+{
+    if (activeDetMode == detPeak)
+        return;
+
+    // hybrid keeps the peak aside (tmp = a row the gain computer fills later)
+    if (activeDetMode == detHybrid)
+        FVO::copy (tmp, det, numSamples);
+
+    rms[lane].process (det, numSamples);
+
+    if (activeDetMode == detHybrid)
+    {
+        FVO::add (det, tmp, numSamples);
+        FVO::multiply (det, 0.5f, numSamples);
+    }
+}
+
+float AuricCompressorEngine::envelopeStage (float* envInOut, int numSamples, float atk, const float* rel) noexcept
+{
+    float peak = 0.0f;
+
+    if (rel != nullptr)
+        onePoleStage<true> (envInOut, numSamples, env[0], atk, rel, peak);
+    else
+        onePoleStage<true> (envInOut, numSamples, env[0], atk, Settled { relLeakRamp.getValue() }, peak);
+
+    return peak;
+}
+
+void AuricCompressorEngine::envelopePairStage (float* env0, float* env1, int numSamples, float atk, const float* rel,
+                                               float* peaks) noexcept
+{
+    peaks[0] = peaks[1] = 0.0f;
+
+    if (rel != nullptr)
+        bandPairStage<true> (bandFrameData, env0, env1, numSamples, env, atk, rel, peaks);
+    else
+        bandPairStage<true> (bandFrameData, env0, env1, numSamples, env, atk, Settled { relLeakRamp.getValue() }, peaks);
+}
+
+void AuricCompressorEngine::gainComputerStage (const float* envIn, float* targetOut, int numSamples,
+                                               const AuricGainCurve::Table& curve) noexcept
+{
+    // log2 first (vectorized), then the table walk in place
+    for (int n = 0; n < numSamples; ++n)
+        targetOut[n] = AuricFastMath::fastLog2 (envIn[n] + envFloor);
+
+    // same per-sample test as the idle shortcut -> exactly 1 there, so a chunk
+    // gives the same gain whether it took the shortcut or not (sub-block invariance)
+    for (int n = 0; n < numSamples; ++n)
+        targetOut[n] = (envIn[n] + envFloor <= curve.idleBelow) ? 1.0f : curve.gainAtLog2 (targetOut[n]);
+}
+
+float AuricCompressorEngine::gainSmootherStage (float* targetInOut, int numSamples, float atk, const float* rel) noexcept
+{
+    float minGain = 1.0f;
+
+    // gain falling = attack
+    if (rel != nullptr)
+        onePoleStage<false> (targetInOut, numSamples, gainLin[0], atk, rel, minGain);
+    else
+        onePoleStage<false> (targetInOut, numSamples, gainLin[0], atk, Settled { relLeakRamp.getValue() }, minGain);
+
+    // (the snap to 1 happens on the sub-block grid, see process())
+    return minGain;
+}
+
+float AuricCompressorEngine::gainSmootherPairStage (float* gain0, float* gain1, int numSamples, float atk, const float* rel) noexcept
+{
+    float minGain[2] = { 1.0f, 1.0f };
+
+    if (rel != nullptr)
+        bandPairStage<false> (bandFrameData, gain0, gain1, numSamples, gainLin, atk, rel, minGain);
+    else
+        bandPairStage<false> (bandFrameData, gain0, gain1, numSamples, gainLin, atk, Settled { relLeakRamp.getValue() }, minGain);
+
+    return juce::jmin (minGain[0], minGain[1]);
+}
+
+void AuricCompressorEngine::blendStage (float* dest, const float* dry, const float* wet,
+                                        const float* amountRamp, float amount, int numSamples) noexcept
+{
+    // dest = dry + amount * (wet - dry)  (same as juce::jmap)
+    auto* diff = dest;
+    FVO::subtract (diff, wet, dry, numSamples);
+    applyGain (diff, diff, amountRamp, amount, numSamples);
+    FVO::add (dest, dry, numSamples);
+}
+
+float AuricCompressorEngine::crossfadeStage (float* const* to, const float* const* from, int numChannels,
+                                             int numSamples, float gain, float step) noexcept
+{
+    float g = gain;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* y = to[ch];
+        const auto* x = from[ch];
+        g = gain;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            g = juce::jlimit (0.0f, 1.0f, g + step);
+            y[n] = x[n] + g * (y[n] - x[n]);
+        }
+    }
+
+    return g;
+}
+
+void AuricCompressorEngine::driveStage (float* const* wet, int numChannels, int numSamples, int factorLog2,
+                                        int phase, int adaaOrder, AuricSaturator::AdaaAtan* states, int approx,
+                                        const float* driveR, const float* driveNormR) noexcept
+{
+    // drive gain at base rate, so the shaper itself has no parameters
+    for (int ch = 0; ch < numChannels; ++ch)
+        applyGain (wet[ch], wet[ch], driveR, driveRamp.getValue(), numSamples);
+
+    if (adaaOrder > 0)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            states[ch].process (wet[ch], numSamples, adaaOrder);
+    }
+    else
+    {
+        oversampler.processWith (factorLog2, phase, wet, numChannels, numSamples, [approx] (float* x, int n)
+        {
+            AuricSaturator::shape (x, n, approx);
+        });
+    }
+
+    // output norm lags the drive latency during an EDGE ramp (a few samples of a 20 ms ramp)
+    for (int ch = 0; ch < numChannels; ++ch)
+        applyGain (wet[ch], wet[ch], driveNormR, driveNormRamp.getValue(), numSamples);
+}
@@ -0,0 +1,384 @@
+//==============================================================================
+// AuricCompressorEngine.h  (AURIC Ω76) — staged block compressor kernel
+//  trim -> detector -> gain computer -> apply/drive -> mix
+//  - Every stage that is not a serial recursion runs over contiguous arrays
+//    (FloatVectorOperations = SSE/AVX/NEON inside JUCE)
+//  - Only the envelope + gain smoother stay per-sample (they are recursions)
+//  - Chunk kernel is instantiated per routing x SC filter x mono/stereo/N and
+//    picked once per block from a table (no config branches inside)
+//  - Any channel count up to maxChannels (5.1, 7.1, 7.1.4 ...): one linked
+//    detector/gain computer for all channels, only trim/drive/mix scale with N
+//  - Optional external key (mono / stereo) replaces the input as detector
+//    source; read straight from the host buffer, only the SC filter makes a copy
+//  - SC filter = TPT SVF (AuricSvf: HPF / band-pass / tilt), channels as SIMD
+//    lanes; cutoff ramps at control rate, coefficients glide per sub-block
+//  - Lookahead: audio (not the detector) runs through a ring delay, the
+//    detector takes the sliding max over that window (AuricSlidingMax)
+//  - Detector = peak |x|, windowed RMS (running sum, AuricRunningRms) or the
+//    average of both; window length never changes the cost
+//  - Multiband: LR4 3-band split (AuricCrossover), one detector/gain lane
+//    per band, the three bands stepped as lanes of one SIMD register (one
+//    envelope + one smoother recursion for all of them); bands summed before drive
+//  - Stereo can also run unlinked L/R or M/S: two envelope/gain lanes, stepped
+//    as lanes 0 / 1 of the multiband SIMD recursion; link amount blends the
+//    two detector values before the recursions
+//  - Gain computer = log2 level -> AuricGainCurve table lookup, no per-sample
+//    pow/log10; chunks whose envelope stays under threshold skip it entirely
+//  - Drive runs inside the oversampler; dry/comp paths are delayed to match
+//    (the comp wet is tapped from one ring: pad ahead of the drive, or the
+//    whole delay when the drive is off)
+//  - Mode changes never gap the output: a new drive variant (oversampling /
+//    ADAA) crossfades against the old one (a latency change crossfades the
+//    dry taps with it), the lookahead tap glides, the band split swaps under
+//    a fade to the plain dry
+//  - Drive = AuricSaturator (fast atan, specialised per Ω mode at compile time),
+//    or its ADAA form at x1 (dry/comp paths delayed by its whole-sample part)
+//  - Continuous settings (trim, release, drive, hard, mix, Ω mix) are smoothed
+//    into per-sample ramps (AuricParamRamp); settled ones stay scalar
+//  - Fixed 64-sample sub-blocks on an absolute grid: L1-sized scratch and
+//    output independent of how the host slices its buffers (bit-exact, bar
+//    float rounding in a scattered mono / stereo SVF; see Tests/)
+//  - float and double host buffers share the same kernel: double I/O is
+//    converted per sub-block at the edges (in L1), the DSP itself runs in float
+//  - Control rate (eco, or automatic above 96 kHz): envelope peak held per
+//    4 / 8 sample frame on the absolute grid, gain computer + smoother step
+//    once per frame, gain interpolated back to audio rate
+//  - Sleep: input (and key) under -120 dBFS for 100 ms past the latency and
+//    nothing left to release -> state cleared to silence, kernel skipped,
+//    output zeroed; the first non-silent block wakes it on that clean state
+//  - All scratch is allocated in prepare(), never in process()
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include "AuricBlockDelay.h"
+#include "AuricCrossover.h"
+#include "AuricGainCurve.h"
+#include "AuricOversampler.h"
+#include "AuricParamRamp.h"
+#include "AuricRunningRms.h"
+#include "AuricSaturator.h"
+#include "AuricSlidingMax.h"
+#include "AuricSvf.h"
+
+class AuricCompressorEngine
+{
+public:
+    enum Routing
+    {
+        routingA = 0,   // comp
+        routingD,       // drive
+        routingOmega,   // comp -> drive, Ω mix against the input
+        numRoutings
+    };
+
+    // Block-rate settings, derived from APVTS by the processor
+    // (continuous ones are targets; the engine ramps towards them per sample)
+    struct Settings
+    {
+        float inGain      = 1.0f;
+        const AuricGainCurve::Table* curve = nullptr;   // static curve, pinned for the block
+        float atkLeak     = 1.0f;    // one-pole step, 1 - exp (-1 / (t * sr))
+        float relLeak     = 1.0f;
+        float driveBase   = 1.0f;    // MODE knob; Ω mode boost is folded in per voicing
+        float hard        = 1.0f;
+        float mix         = 1.0f;
+        float omegaMix    = 1.0f;
+        int   routing     = 0;       // Routing: 0 A (comp), 1 D (drive), 2 Ω (comp -> drive)
+        int   scMode      = 0;       // ScMode (stereo only; mono / multichannel are always linked)
+        float scLink      = 0.0f;    // 0 = independent lanes .. 1 = both lanes see the linked value
+        int   detMode     = 0;       // DetMode
+        bool  detEco      = false;   // detector at control rate at any sample rate (manual / CPU governor)
+        int   rmsWindow   = 1;       // samples (<= maxRmsWindowSeconds), RMS / hybrid only
+        int   omegaMode   = 0;       // 0 CLEAN, 1 IRON, 2 GRIT (saturator voicing)
+        bool  satEco      = false;   // cheapest atan approximation (CPU governor)
+        bool  scHpf       = false;   // sidechain filter on (shape + cutoff below)
+        int   scShape     = 0;       // AuricSvf::Shape
+        float scFreq      = 120.0f;  // Hz, ramped (control rate)
+        int   osFactorLog2 = 0;      // 0 x1, 1 x2, 2 x4 (drive stage only)
+        int   osPhase      = AuricOversampler::minimumPhase;
+        int   adaaOrder    = 0;      // 1 / 2 = ADAA drive instead of oversampling (x1 only)
+        bool  multiband    = false;  // 3-band split, own envelope / gain per band (swapped under a fade to the dry)
+        float xoverLow     = 200.0f; // Hz, ramped (control rate)
+        float xoverHigh    = 2500.0f;
+        int   lookahead    = 0;      // samples (<= maxLookaheadSeconds): audio delayed against the detector
+        int   latencyFloor = 0;      // pad total latency up to this (governor keeps PDC fixed)
+    };
+
+    enum ScMode
+    {
+        scLinked = 0,   // one detector: 0.5 * (|L| + |R|)
+        scDualLR,       // L and R each get their own gain
+        scDualMS,       // mid and side each get their own gain
+        numScModes
+    };
+
+    enum DetMode
+    {
+        detPeak = 0,    // rectified |x|
+        detRms,         // sqrt of the mean square over rmsWindow
+        detHybrid,      // 0.5 * (peak + RMS)
+        numDetModes
+    };
+
+    // internal processing grid, independent of the host block size (power of two)
+    static constexpr int subBlockSize = 64;
+
+    // widest bus (9.1.6)
+    static constexpr int maxChannels = 16;
+    // external sidechain (key) bus
+    static constexpr int maxKeyChannels = 2;
+    // lookahead range (delay + peak window are sized for this in prepare())
+    static constexpr double maxLookaheadSeconds = 0.010;
+    // RMS window range (ring sized for this in prepare())
+    static constexpr double maxRmsWindowSeconds = 0.100;
+    // sleep: input this quiet (-120 dBFS) for this long (+ latency) with no GR left
+    static constexpr float sleepThreshold = 1.0e-6f;
+    static constexpr double sleepAfterSeconds = 0.100;
+    // detector control rate: full rate up to this, then frames of 4 / 8 samples
+    static constexpr double fullRateDetectorMaxHz = 96000.0;
+    static constexpr int maxControlRateLog2 = 3;
+    static_assert ((subBlockSize >> maxControlRateLog2) << maxControlRateLog2 == subBlockSize,
+                   "frames must tile the sub-block grid");
+
+    AuricCompressorEngine() = default;
+
+    // per-channel state (oversampler, delays, SC filter, ADAA) is sized for numChannels
+    void prepare (double sampleRate, int numChannels);
+    void reset() noexcept;
+
+    // false: no automatic control rate above 96 kHz (eco still applies) — the full-rate
+    // reference for the GR error measurement in Tests/
+    void setAutoControlRate (bool shouldBeAuto) noexcept { autoControlRate = shouldBeAuto; }
+
+    // In-place on numChannels (<= prepared) channels. Returns peak GR in dB (positive).
+    // key (numKeyChannels 1..2) = external sidechain, nullptr = detect the input itself.
+    // SampleType = float or double (instantiated in the .cpp)
+    template <typename SampleType>
+    float process (SampleType* const* channels, int numChannels, int numSamples, const Settings& s,
+                   const SampleType* const* key = nullptr, int numKeyChannels = 0) noexcept;
+
+    // PWR off: input only goes through the latency-matching delay
+    template <typename SampleType>
+    void processBypassed (SampleType* const* channels, int numChannels, int numSamples,
+                          int osFactorLog2, int osPhase, int adaaOrder, int lookahead, int latencyFloor) noexcept;
+
+    // Latency of the running mode incl. lookahead + padding (base-rate samples; where a tap ramps to)
+    int getLatencySamples() const noexcept
+    {
+        return lookaheadDelay.getDelay() + dryDelay.getDelay();
+    }
+    int getOversamplingFactor() const noexcept { return oversampler.getFactor(); }
+    int getLatencySamplesFor (int osFactorLog2, int osPhase, int adaaOrder = 0, int lookahead = 0) const noexcept
+    {
+        return oversampler.getLatencySamplesFor (osFactorLog2, osPhase)
+             + AuricSaturator::AdaaAtan::getLatencySamples (osFactorLog2 == 0 ? adaaOrder : 0)
+             + juce::jlimit (0, maxLookahead, lookahead);
+    }
+
+private:
+    // channel layout x detection, one kernel each
+    enum KernelLayout
+    {
+        layoutMono = 0,
+        layoutStereo,       // linked
+        layoutMulti,        // linked, any count (read at run time)
+        layoutDualLR,       // stereo, two lanes
+        layoutDualMS,
+        layoutMultiband,    // any count, 3 bands, linked per band
+        numLayouts
+    };
+
+    // one instantiation per routing x SC HPF x layout, picked per block
+    template <int Routing, bool ScHpf, int Layout>
+    float processChunk (float* const* io, int numChannels, int numSamples, const Settings& s) noexcept;
+
+    using ChunkKernel = float (AuricCompressorEngine::*) (float* const*, int, int, const Settings&) noexcept;
+    static const ChunkKernel chunkKernels[numRoutings][2][numLayouts];   // [routing][scHpf][layout]
+
+    // stages
+    template <bool ScHpf>
+    const float* const* sidechainSourceStage (const float* const* source, int numSources, int numSamples) noexcept;
+    template <bool ScHpf, int NumCh>
+    void detectorStage (int numChannels, float* det, int numSamples) noexcept;
+    template <bool ScHpf, bool MidSide>
+    void detectorPairStage (float* det0, float* det1, float link, int numSamples) noexcept;
+    float envelopeStage (float* envInOut, int numSamples, float atk, const float* rel) noexcept;
+    void detectorShapeStage (float* det, float* tmp, int lane, int numSamples) noexcept;
+    void envelopePairStage (float* env0, float* env1, int numSamples, float atk, const float* rel,
+                            float* peaks) noexcept;
+    static void gainComputerStage (const float* envIn, float* targetOut, int numSamples,
+                                   const AuricGainCurve::Table& curve) noexcept;
+    float gainSmootherStage (float* targetInOut, int numSamples, float atk, const float* rel) noexcept;
+    float gainSmootherPairStage (float* gain0, float* gain1, int numSamples, float atk, const float* rel) noexcept;
+    bool bandDetectorStage (int numChannels, float* const* det, int numSamples) noexcept;
+    float bandGainStage (const float* const* det, float* const* gains, int numSamples, float atk, const float* rel,
+                         float gainAtk, const float* gainRel, const AuricGainCurve::Table& curve) noexcept;
+    // control rate: frames ending in this chunk, per-frame release, envelope peak down, gain back up
+    int controlRateLog2For (bool eco) const noexcept;
+    void setControlRate (int rateLog2) noexcept;
+    int controlFrameCount (int numSamples) const noexcept;
+    const float* controlReleaseStage (const float* rel, int numSamples) noexcept;
+    void decimateStage (float* det, int lane, int numSamples) noexcept;
+    void interpolateStage (float* gains, int lane, int numSamples) noexcept;
+    // latency-changing mode (oversampling, ADAA, lookahead) or band split on/off:
+    // request records the target, the change starts on the sub-block grid;
+    // set jumps straight there (first block, asleep)
+    void setOversampling (int factorLog2, int phase, int adaaOrderWanted, int lookahead, int latencyFloor) noexcept;
+    void requestOversampling (int factorLog2, int phase, int adaaOrderWanted, int lookahead, int latencyFloor) noexcept;
+    bool switchDiffers() const noexcept;
+    void startPendingSwitch() noexcept;
+    void setMultiband (bool shouldSplit) noexcept;
+    // dry tap past the lookahead: reported latency minus lookahead, never under the drive's own
+    int getDryTapFor (int factorLog2, int phase, int adaaOrder, int lookahead, int latencyFloor) const noexcept;
+    int getDriveLatency() const noexcept
+    {
+        return oversampler.getLatencySamples() + AuricSaturator::AdaaAtan::getLatencySamples (activeAdaaOrder);
+    }
+    void driveStage (float* const* wet, int numChannels, int numSamples, int factorLog2, int phase, int adaaOrder,
+                     AuricSaturator::AdaaAtan* states, int approx, const float* driveR, const float* driveNormR) noexcept;
+    // to = from + g (to - from), g stepped per sample (0..1); returns where g ended
+    static float crossfadeStage (float* const* to, const float* const* from, int numChannels, int numSamples,
+                                 float gain, float step) noexcept;
+    void applySwitchFade (float* const* channels, int numChannels, int numSamples, bool atGridEdge) noexcept;
+    // everything that carries signal (filters, delays, envelopes) back to silence
+    void clearSignalState() noexcept;
+    // asleep: no kernel, only the bookkeeping that has to stay on time (ramps, grid, mode swaps)
+    void sleepBlock (int numSamples) noexcept;
+    bool canSleep() const noexcept;
+    static void blendStage (float* dest, const float* dry, const float* wet,
+                            const float* amountRamp, float amount, int numSamples) noexcept;
+    void setRampTargets (const Settings& s, int numSamples) noexcept;
+
+    // host I/O <-> float sub-block (float: the host buffer itself, double: ioRows)
+    template <typename SampleType>
+    float* loadSubBlock (SampleType* src, int ch, int numSamples) noexcept;
+    template <typename SampleType>
+    const float* loadKeySubBlock (const SampleType* src, int ch, int numSamples) noexcept;
+    template <typename SampleType>
+    static void storeSubBlock (SampleType* dest, const float* src, int numSamples) noexcept;
+
+    // scratch rows: 8 shared + 7 per channel (stereo ~5.5 KB, 7.1.4 ~23 KB)
+    enum SharedRow
+    {
+        bufEnv = 0,            // rectified detector -> envelope
+        bufGain,               // target gain -> smoothed gain
+        bufEnv2, bufGain2,     // second lane (R / side) of the dual modes, mid band
+        bufEnv3, bufGain3,     // high band
+        bufKey0, bufKey1,      // double key buffer, converted sub-block
+        numSharedRows
+    };
+
+    enum ChannelRow
+    {
+        rowX = 0,              // trimmed input (dry)
+        rowD,                  // detector source (SC-filtered copy)
+        rowWet,                // processed path
+        rowIo,                 // double host buffer, converted sub-block
+        rowLow, rowMid, rowHigh,   // multiband split (key bands first, then the audio)
+        numChannelRows
+    };
+
+    juce::AudioBuffer<float> scratch;
+    float* xRows[maxChannels] {};       // row pointers, fixed in prepare()
+    float* dRows[maxChannels] {};
+    float* wetRows[maxChannels] {};
+    float* ioRows[maxChannels] {};
+    float* bandRows[AuricCrossover::numBands][maxChannels] {};
+    int numPrepared { 0 };              // channels with state
+    const float* keyRows[maxKeyChannels] {};   // current sub-block of the key, if any
+    int numKey { 0 };
+    int maxChunk { 0 };
+    int gridPos { 0 };                  // position inside the current sub-block
+
+    double sr { 44100.0 };
+
+    // sidechain filter for the detector (lane = channel / key channel)
+    AuricSvf scFilter;
+    bool scFilterLive { false };         // false: the next cutoff / shape is jumped to, not glided in
+
+    // drive-only oversampling + latency alignment for the other paths
+    AuricOversampler oversampler;
+    AuricBlockDelay dryDelay;   // trimmed input (Ω blend + wet/dry), up to latencyFloor
+    AuricBlockDelay wetDelay;   // comp wet: pad tap ahead of the drive, or the whole delay for comp only
+    AuricBlockDelay lookaheadDelay;   // trimmed input, ahead of gain / drive (+ plain dry for the band switch)
+    // detector lanes: L/R or M/S in the dual modes, one per band in multiband
+    AuricSlidingMax peakHold[AuricCrossover::numBands];   // max over the lookahead window
+    int maxLookahead { 0 };
+    AuricRunningRms rms[AuricCrossover::numBands];        // RMS / hybrid modes
+    int activeDetMode { 0 };
+    bool driveWasActive { false };
+    bool asleep { false };
+    int  silentSamples { 0 };       // consecutive input samples under sleepThreshold
+    int  sleepAfterSamples { 0 };
+
+    // detector control rate (0 = full rate); frames start on multiples of the frame
+    // size in the sub-block grid, so hosts slicing blocks differently see the same frames
+    int   activeCtlLog2 { 0 };
+    int   targetCtlLog2 { 0 };
+    bool  autoControlRate { true };
+    float ctlPeak[AuricCrossover::numBands] {};                   // envelope peak of the open frame, per lane
+    float ctlFrom[AuricCrossover::numBands] { 1.0f, 1.0f, 1.0f }; // gain interpolated from..
+    float ctlTo[AuricCrossover::numBands]   { 1.0f, 1.0f, 1.0f }; // ..to, over the current frame
+    float ctlRel[subBlockSize] {};                               // release leak per frame
+
+    // multiband: audio split, plus a detector split for the key or when lookahead
+    // puts the audio behind the detector (otherwise the audio bands are reused)
+    using BandVec = juce::dsp::SIMDRegister<float>;
+    AuricCrossover crossover;
+    AuricCrossover detCrossover;
+    bool detCrossoverLive { false };
+    bool crossoverLive { false };        // false: the next cutoffs are jumped to, not glided in from stale ones
+    bool activeMultiband { false };
+    juce::HeapBlock<float> bandFrames;   // env + gain, maxChunk x lanes each (one register per sample)
+    float* bandFrameData { nullptr };    // bandFrames from the first BandVec-aligned float
+    BandVec bandEnv { BandVec::expand (0.0f) };
+    BandVec bandGain { BandVec::expand (1.0f) };
+
+    // x1 alternative to oversampling: antiderivative anti-aliased drive (per channel)
+    AuricSaturator::AdaaAtan adaa[maxChannels];
+    int activeAdaaOrder { 0 };
+
+    // mode changes, started on the sub-block grid (same sample for any host block size):
+    //  - drive variant: old + new path run side by side and crossfade, dry untouched
+    //  - reported latency: dry / comp taps crossfade with the drive (AuricBlockDelay::rampDelay)
+    //  - lookahead: the audio tap glides there (AuricBlockDelay::glideDelay)
+    //  - band split on/off: output fades to the plain dry, split swaps there, fades back
+    int   targetFactorLog2 { 0 };
+    int   targetPhase { AuricOversampler::minimumPhase };
+    int   targetAdaaOrder { 0 };
+    int   targetLookahead { 0 };
+    bool  targetMultiband { false };
+    int   targetLatencyFloor { 0 };
+    bool  switchPending { false };
+    bool  snapMode { true };       // first block after prepare/reset: no fade
+    float switchStep { 1.0f };
+    int   drivePad { 0 };          // wet ring tap ahead of the drive (tops it up to the dry tap)
+    float driveFade { 1.0f };      // weight of the new drive path, 0 -> 1
+    bool  driveFadeDual { false }; // variant changed: the old one runs too (else only the pad tap moved)
+    int   fadeFactorLog2 { 0 };    // old path while driveFade < 1
+    int   fadePhase { AuricOversampler::minimumPhase };
+    int   fadeAdaaOrder { 0 };
+    int   fadePad { 0 };
+    AuricSaturator::AdaaAtan adaaFade[maxChannels];
+    float bandFade { 1.0f };       // band split switch: processed output vs plain dry
+
+    // envelope + gain smoothing state; lane 1 = R / side, mirrors lane 0 while linked
+    float env[2] { 0.0f, 0.0f };
+    float gainLin[2] { 1.0f, 1.0f };
+
+    // parameter ramps (drive = k pre-gain, drive norm = 1 / atan(hard) post-gain)
+    AuricParamRamp inGainRamp   { AuricParamRamp::multiplicative };
+    AuricParamRamp relLeakRamp  { AuricParamRamp::multiplicative };
+    AuricParamRamp driveRamp    { AuricParamRamp::multiplicative };
+    AuricParamRamp driveNormRamp { AuricParamRamp::linear };
+    AuricParamRamp mixRamp      { AuricParamRamp::linear };
+    AuricParamRamp omegaMixRamp { AuricParamRamp::linear };
+    AuricParamRamp scFreqRamp   { AuricParamRamp::multiplicative };   // read per sub-block only
+    AuricParamRamp xoverLowRamp  { AuricParamRamp::multiplicative };  // same
+    AuricParamRamp xoverHighRamp { AuricParamRamp::multiplicative };
+    bool rampsPrimed { false };   // first block after prepare/reset/bypass: jump, don't ramp
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricCompressorEngine)
+};
@@ -0,0 +1,137 @@
+//==============================================================================
+// AuricCpuGovernor.cpp  (AURIC Ω76)
+//==============================================================================
+
+#include "AuricCpuGovernor.h"
+
+#include <cmath>
+
+//==============================================================================
+void AuricCpuGovernor::prepare (double sampleRate)
+{
+    sr = juce::jmax (1.0, sampleRate);
+    reset();
+}
+
+void AuricCpuGovernor::reset() noexcept
+{
+    level.store (0);
+    smoothedLoad.store (0.0f);
+
+    loadState = 0.0f;
+    timeSinceStep = 0.0;
+    headroomTime = 0.0;
+    consecutiveMisses = 0;
+}
+
+//==============================================================================
+void AuricCpuGovernor::endBlock (juce::int64 startTicks, int numSamples, bool enabled) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    const double deadlineSec = (double) numSamples / sr;
+    const double elapsedSec  = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+    const float load = (float) (elapsedSec / deadlineSec);
+
+    // one-pole over wall time, so the budget means the same at 32 or 4096 samples
+    const float a = (float) (1.0 - std::exp (-deadlineSec / budget.smoothingSec));
+    loadState += a * (load - loadState);
+    smoothedLoad.store (loadState, std::memory_order_relaxed);
+
+    timeSinceStep += deadlineSec;
+
+    const int current = level.load (std::memory_order_relaxed);
+
+    if (! enabled)
+    {
+        if (current != 0)
+            stepTo (0, disabled, loadState);
+
+        consecutiveMisses = 0;
+        headroomTime = 0.0;
+        return;
+    }
+
+    consecutiveMisses = (load >= budget.missLoad) ? consecutiveMisses + 1 : 0;
+
+    const bool overBudget = loadState > budget.stepDownLoad;
+    const bool missing    = consecutiveMisses >= budget.missesToStep;
+
+    if ((overBudget || missing) && current < maxLevel && timeSinceStep >= budget.downHoldSec)
+    {
+        stepTo (current + 1, missing ? deadlineMiss : overload, loadState);
+        consecutiveMisses = 0;
+        headroomTime = 0.0;
+        return;
+    }
+
+    if (current > 0 && loadState < budget.stepUpLoad)
+    {
+        headroomTime += deadlineSec;
+
+        if (headroomTime >= budget.upHoldSec)
+        {
+            stepTo (current - 1, recovered, loadState);
+            headroomTime = 0.0;
+        }
+    }
+    else
+    {
+        headroomTime = 0.0;
+    }
+}
+
+void AuricCpuGovernor::stepTo (int newLevel, int reason, float load) noexcept
+{
+    const int oldLevel = level.load (std::memory_order_relaxed);
+    newLevel = juce::jlimit (0, maxLevel, newLevel);
+
+    if (newLevel == oldLevel)
+        return;
+
+    level.store (newLevel, std::memory_order_relaxed);
+    timeSinceStep = 0.0;
+
+    const auto n = numEvents.load (std::memory_order_relaxed);
+    auto& e = events[n % (juce::uint32) logCapacity];
+
+    e.timeMs    = juce::Time::currentTimeMillis();
+    e.fromLevel = oldLevel;
+    e.toLevel   = newLevel;
+    e.load      = load;
+    e.reason    = reason;
+
+    numEvents.store (n + 1, std::memory_order_release);
+}
+
+//==============================================================================
+void AuricCpuGovernor::getEvents (std::vector<Event>& dest) const
+{
+    dest.clear();
+
+    const auto end   = numEvents.load (std::memory_order_acquire);
+    const auto begin = end > (juce::uint32) logCapacity ? end - (juce::uint32) logCapacity : 0u;
+
+    for (auto i = begin; i < end; ++i)
+        dest.push_back (events[i % (juce::uint32) logCapacity]);
+
+    // drop anything the audio thread may have overwritten while we copied
+    const auto after = numEvents.load (std::memory_order_acquire);
+    const auto safeBegin = after + 1u > (juce::uint32) logCapacity ? after + 1u - (juce::uint32) logCapacity : 0u;
+
+    if (safeBegin > begin)
+        dest.erase (dest.begin(), dest.begin() + (int) juce::jmin ((juce::uint32) dest.size(), safeBegin - begin));
+}
+
+juce::String AuricCpuGovernor::reasonToString (int reason)
+{
+    switch (reason)
+    {
+        case overload:     return "over budget";
+        case deadlineMiss: return "deadline miss";
+        case recovered:    return "headroom";
+        case disabled:     return "off";
+        default:           return {};
+    }
+}
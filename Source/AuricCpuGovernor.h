@@ -0,0 +1,87 @@
+//==============================================================================
+// AuricCpuGovernor.h  (AURIC Ω76) — deadline-aware quality governor
+//  - Times every processBlock against its real-time deadline (numSamples / sr)
+//  - Smoothed load over budget -> step quality DOWN (fast, short hold)
+//  - Sustained headroom         -> step quality UP   (slow, long hold)
+//  - Step changes go to a fixed ring log (audio thread writes, UI reads)
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+class AuricCpuGovernor
+{
+public:
+    enum Reason
+    {
+        overload = 0,   // smoothed load above budget
+        deadlineMiss,   // consecutive blocks close to / over the deadline
+        recovered,      // headroom held long enough
+        disabled        // governor switched off or offline render
+    };
+
+    struct Event
+    {
+        juce::int64 timeMs = 0;  // wall clock (juce::Time::currentTimeMillis)
+        int fromLevel = 0;
+        int toLevel   = 0;
+        float load    = 0.0f;    // smoothed load at the step (1.0 = whole deadline)
+        int reason    = overload;
+    };
+
+    struct Budget
+    {
+        float stepDownLoad   = 0.45f;   // fraction of the deadline this instance may use
+        float stepUpLoad     = 0.20f;   // must fall below this to recover (hysteresis)
+        float missLoad       = 0.90f;   // a single block this heavy counts as a miss
+        int   missesToStep   = 2;
+        double downHoldSec   = 0.6;     // > smoothing, so a cheaper level is judged on its own cost
+        double upHoldSec     = 3.0;     // headroom needed before stepping up
+        double smoothingSec  = 0.30;
+    };
+
+    static constexpr int logCapacity = 64;
+
+    AuricCpuGovernor() = default;
+
+    void prepare (double sampleRate);
+    void reset() noexcept;
+
+    void setMaxLevel (int newMaxLevel) noexcept    { maxLevel = juce::jmax (0, newMaxLevel); }
+    void setBudget (const Budget& b) noexcept      { budget = b; }
+
+    // audio thread
+    static juce::int64 beginBlock() noexcept       { return juce::Time::getHighResolutionTicks(); }
+    void endBlock (juce::int64 startTicks, int numSamples, bool enabled) noexcept;
+
+    // any thread
+    int   getLevel() const noexcept                { return level.load (std::memory_order_relaxed); }
+    float getLoad() const noexcept                 { return smoothedLoad.load (std::memory_order_relaxed); }
+    int   getNumEventsLogged() const noexcept      { return (int) numEvents.load (std::memory_order_acquire); }
+
+    // Copies out up to logCapacity most recent events, oldest first.
+    void getEvents (std::vector<Event>& dest) const;
+
+    static juce::String reasonToString (int reason);
+
+private:
+    void stepTo (int newLevel, int reason, float load) noexcept;
+
+    Budget budget;
+    double sr { 44100.0 };
+    int maxLevel { 0 };
+
+    std::atomic<int> level { 0 };
+    std::atomic<float> smoothedLoad { 0.0f };
+
+    float loadState { 0.0f };
+    double timeSinceStep { 0.0 };
+    double headroomTime { 0.0 };
+    int consecutiveMisses { 0 };
+
+    // single writer (audio thread), readers re-validate against numEvents
+    Event events[logCapacity];
+    std::atomic<juce::uint32> numEvents { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricCpuGovernor)
+};
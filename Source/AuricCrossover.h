@@ -0,0 +1,97 @@
+//==============================================================================
+// AuricCrossover.h  (AURIC Ω76) — 3-band Linkwitz-Riley (LR4) split
+//  - Each split point: Butterworth low-pass twice = LR4 low, and the
+//    Butterworth all-pass of the same cutoff minus that = LR4 high
+//    (low + high is the all-pass by construction, no matching to get wrong)
+//  - Low band also goes through the upper split's all-pass, so
+//    low + mid + high = the two all-passes in series: flat magnitude
+//  - 5 AuricSvf recursions (the first low-pass and the all-pass of a split
+//    share one state, two outputs); channels / time in SIMD lanes, cutoffs
+//    set per chunk and glided like the SC filter
+//  - Runs in place on the band rows, no scratch of its own
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include "AuricSvf.h"
+
+#include <array>
+
+class AuricCrossover
+{
+public:
+    enum Band
+    {
+        bandLow = 0,
+        bandMid,
+        bandHigh,
+        numBands
+    };
+
+    // upper split never closer than this to the lower one (mid band keeps some width)
+    static constexpr float minSplitRatio = 2.0f;
+
+    AuricCrossover() = default;
+
+    void prepare (double sampleRate, int maxBlockSize)
+    {
+        for (auto* f : sections())
+            f->prepare (sampleRate, maxBlockSize);
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto* f : sections())
+            f->reset();
+    }
+
+    // control rate, once per chunk (AuricSvf glides across the next process())
+    void setTargets (float lowHz, float highHz) noexcept
+    {
+        highHz = juce::jmax (highHz, lowHz * minSplitRatio);
+
+        lowSplit.setTarget (lowHz, AuricSvf::lowPass, AuricSvf::allPass);
+        lowLp.setTarget    (lowHz, AuricSvf::lowPass);
+
+        highSplit.setTarget (highHz, AuricSvf::lowPass, AuricSvf::allPass);
+        highLp.setTarget    (highHz, AuricSvf::lowPass);
+        lowComp.setTarget   (highHz, AuricSvf::allPass);
+    }
+
+    // in (may be any rows but the band rows) -> low / mid / high rows per channel
+    void process (const float* const* in, float* const* low, float* const* mid, float* const* high,
+                  int numChannels, int numSamples) noexcept
+    {
+        // lower split: high row holds the all-pass, then becomes the rest above it
+        lowSplit.process (in, low, numChannels, numSamples, high);
+        lowLp.process (low, low, numChannels, numSamples);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            juce::FloatVectorOperations::subtract (high[ch], low[ch], numSamples);
+
+        // upper split of the rest, same trick
+        highSplit.process (high, mid, numChannels, numSamples, high);
+        highLp.process (mid, mid, numChannels, numSamples);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            juce::FloatVectorOperations::subtract (high[ch], mid[ch], numSamples);
+
+        // low band gets the phase the other two picked up at the upper split
+        lowComp.process (low, low, numChannels, numSamples);
+    }
+
+private:
+    std::array<AuricSvf*, 5> sections() noexcept
+    {
+        return { &lowSplit, &lowLp, &highSplit, &highLp, &lowComp };
+    }
+
+    AuricSvf lowSplit, lowLp;     // lower split point: (low-pass, all-pass), 2nd low-pass
+    AuricSvf highSplit, highLp;   // upper split point
+    AuricSvf lowComp;             // all-pass at the upper split, low band only
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricCrossover)
+};
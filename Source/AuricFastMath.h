@@ -0,0 +1,56 @@
+//==============================================================================
+// AuricFastMath.h  (AURIC Ω76) — branch-free log2 / exp2 for the gain computer
+//  - Exponent from the float bits, mantissa through a minimax (Remez) poly
+//  - No table, no branch -> loops over blocks auto-vectorize
+//      fastLog2   max |err| 1.5e-5 (log2 units, ~9e-5 dB)   x > 0, normal
+//      fastExp2   max rel err 9.3e-6 (~8e-5 dB)              -126 < x < 126
+//  dB <-> log2: dB = log2 * 6.0206 (20 * log10 (2))
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include <cstring>
+
+namespace AuricFastMath
+{
+    static constexpr float dbPerLog2 = 6.02059991f;   // 20 * log10 (2)
+    static constexpr float log2PerDb = 1.0f / dbPerLog2;
+
+    inline float fastLog2 (float x) noexcept
+    {
+        juce::int32 bits;
+        std::memcpy (&bits, &x, sizeof (bits));
+
+        const float e = (float) (((bits >> 23) & 0xff) - 127);
+
+        // mantissa -> [1, 2)
+        bits = (bits & 0x007fffff) | 0x3f800000;
+        float m;
+        std::memcpy (&m, &bits, sizeof (m));
+
+        // log2 (1 + u), u in [0, 1)
+        const float u = m - 1.0f;
+        const float p = u * (1.441965618f + u * (-0.709662829f + u * (0.417595805f
+                      + u * (-0.196269660f + u * 0.046385369f))));
+
+        return e + p;
+    }
+
+    inline float fastExp2 (float x) noexcept
+    {
+        // shift positive so truncation == floor, integer part lands on the exponent field
+        const float t = x + 127.0f;
+        const juce::int32 i = (juce::int32) t;
+        const float u = t - (float) i;
+
+        // 2^u, u in [0, 1)
+        const float p = 1.0f + u * (0.693018530f + u * (0.241445504f + u * (0.051950549f + u * 0.013581248f)));
+
+        const juce::int32 bits = i << 23;
+        float scale;
+        std::memcpy (&scale, &bits, sizeof (scale));
+
+        return scale * p;
+    }
+}
@@ -0,0 +1,79 @@
+//==============================================================================
+// AuricGainCurve.cpp  (AURIC Ω76) — gain-curve tables (one per omegaMode)
+//==============================================================================
+
+#include "AuricGainCurve.h"
+
+#include <cmath>
+
+//==============================================================================
+AuricGainCurve::Params AuricGainCurve::paramsForMode (int omegaMode) noexcept
+{
+    Params p;
+    p.thresholdDb = -18.0f;
+
+    // ratio berdasarkan omegaMode switch (discrete)
+    p.ratio = 2.0f;
+    if (omegaMode == 1) p.ratio = 4.0f;
+    if (omegaMode == 2) p.ratio = 8.0f;
+
+    return p;
+}
+
+const AuricGainCurve::Table& AuricGainCurve::forMode (int omegaMode) noexcept
+{
+    struct Tables
+    {
+        Tables() noexcept
+        {
+            for (int m = 0; m < numModes; ++m)
+                fillTable (t[m], paramsForMode (m));
+        }
+
+        Table t[numModes];
+    };
+
+    // magic static: filled once (processor ctor gets here first), after that a plain load
+    static const Tables tables;
+    return tables.t[juce::jlimit (0, numModes - 1, omegaMode)];
+}
+
+//==============================================================================
+float AuricGainCurve::computeGainDb (float inputDb, const Params& p) noexcept
+{
+    const float slope = 1.0f / p.ratio - 1.0f;
+    const float over  = inputDb - p.thresholdDb;
+
+    if (p.kneeDb <= 0.0f)
+        return over > 0.0f ? over * slope : 0.0f;
+
+    // quadratic knee centred on the threshold
+    const float halfKnee = 0.5f * p.kneeDb;
+
+    if (over <= -halfKnee)
+        return 0.0f;
+
+    if (over >= halfKnee)
+        return over * slope;
+
+    const float k = over + halfKnee;
+    return slope * k * k / (2.0f * p.kneeDb);
+}
+
+void AuricGainCurve::fillTable (Table& t, const Params& p) noexcept
+{
+    t.params = p;
+
+    // move the grid so the threshold lands exactly on a point
+    const float thrLog2 = p.thresholdDb * AuricFastMath::log2PerDb;
+    const float stepsBelow = std::floor ((thrLog2 - Table::minLog2) * Table::pointsPerLog2);
+    t.originLog2 = thrLog2 - stepsBelow / Table::pointsPerLog2;
+
+    for (int i = 0; i <= Table::size; ++i)
+    {
+        const float levelDb = (t.originLog2 + (float) i / Table::pointsPerLog2) * AuricFastMath::dbPerLog2;
+        t.gain[i] = std::pow (10.0f, computeGainDb (levelDb, p) / 20.0f);
+    }
+
+    t.idleBelow = std::pow (10.0f, (p.thresholdDb - 0.5f * juce::jmax (0.0f, p.kneeDb)) / 20.0f);
+}
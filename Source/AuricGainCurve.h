@@ -0,0 +1,75 @@
+//==============================================================================
+// AuricGainCurve.h  (AURIC Ω76) — static compressor curve as a lookup table
+//  - Gain vs detector level (log2 grid), optional soft knee
+//  - Only the three omegaMode curves exist: built once per process (first use,
+//    from the processor's constructor), shared by every instance, read-only after
+//  - No builder thread, nothing to publish or free: processBlock just picks one;
+//    the editor reads the same table
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include "AuricFastMath.h"
+
+class AuricGainCurve
+{
+public:
+    struct Params
+    {
+        float thresholdDb = -18.0f;
+        float ratio       = 2.0f;
+        float kneeDb      = 0.0f;    // 0 = hard knee
+
+        bool operator== (const Params& o) const noexcept
+        {
+            return thresholdDb == o.thresholdDb && ratio == o.ratio && kneeDb == o.kneeDb;
+        }
+        bool operator!= (const Params& o) const noexcept { return ! operator== (o); }
+    };
+
+    struct Table
+    {
+        // ~ -193 .. +144 dBFS, 0.16 dB per point
+        static constexpr int size = 2048;
+        static constexpr float spanLog2 = 56.0f;
+        static constexpr float minLog2 = -32.0f;
+        static constexpr float pointsPerLog2 = (float) size / spanLog2;
+
+        Params params;
+
+        float originLog2 = minLog2;   // shifted so the threshold sits on a grid point (hard knee is exact)
+        float idleBelow  = 0.0f;      // linear detector level under which gain is exactly 1
+        float gain[size + 1] {};      // linear target gain
+
+        // level in log2 (detector), returns linear gain
+        float gainAtLog2 (float levelLog2) const noexcept
+        {
+            const float pos = juce::jlimit (0.0f, (float) size, (levelLog2 - originLog2) * pointsPerLog2);
+            const int i = juce::jmin ((int) pos, size - 1);
+            const float frac = pos - (float) i;
+            return gain[i] + frac * (gain[i + 1] - gain[i]);
+        }
+
+        // UI helper: output level (dB) for an input level (dB)
+        float outputDbAt (float inputDb) const noexcept
+        {
+            const float g = gainAtLog2 (inputDb * AuricFastMath::log2PerDb);
+            return inputDb + 20.0f * std::log10 (juce::jmax (g, 1.0e-9f));
+        }
+    };
+
+    // omegaMode switch (discrete) -> curve: ratio 2 / 4 / 8, threshold -18 dB, hard knee
+    static constexpr int numModes = 3;
+    static Params paramsForMode (int omegaMode) noexcept;
+
+    // any thread (audio included): no lock, no allocation, the table never moves or dies
+    static const Table& forMode (int omegaMode) noexcept;
+
+    static float computeGainDb (float inputDb, const Params& p) noexcept;
+
+private:
+    AuricGainCurve() = delete;
+
+    static void fillTable (Table& t, const Params& p) noexcept;
+};
@@ -0,0 +1,85 @@
+//==============================================================================
+// AuricOversampler.cpp  (AURIC Ω76)
+//==============================================================================
+
+#include "AuricOversampler.h"
+
+//==============================================================================
+void AuricOversampler::prepare (int numChannels, int maxBlockSize)
+{
+    for (int f = 0; f < maxFactorLog2; ++f)
+    {
+        for (int p = 0; p < 2; ++p)
+        {
+            const auto type = (p == linearPhase ? Oversampling::filterHalfBandFIREquiripple
+                                                : Oversampling::filterHalfBandPolyphaseIIR);
+
+            // integer latency -> dry path can be delay-aligned exactly
+            stages[f][p] = std::make_unique<Oversampling> ((size_t) juce::jmax (1, numChannels),
+                                                           (size_t) (f + 1), type, true, true);
+            stages[f][p]->initProcessing ((size_t) juce::jmax (1, maxBlockSize));
+
+            latency[f][p] = juce::roundToInt (stages[f][p]->getLatencyInSamples());
+        }
+    }
+
+    reset();
+}
+
+void AuricOversampler::reset() noexcept
+{
+    for (auto& f : stages)
+        for (auto& p : f)
+            if (p != nullptr)
+                p->reset();
+}
+
+void AuricOversampler::setMode (int newFactorLog2, int newPhase) noexcept
+{
+    newFactorLog2 = juce::jlimit (0, maxFactorLog2, newFactorLog2);
+    newPhase = (newPhase == linearPhase ? linearPhase : minimumPhase);
+
+    if (newFactorLog2 == factorLog2 && newPhase == phase)
+        return;
+
+    factorLog2 = newFactorLog2;
+    phase = newPhase;
+
+    // don't let a variant resume from stale filter history
+    if (auto* os = current())
+        os->reset();
+}
+
+juce::dsp::Oversampling<float>* AuricOversampler::variant (int f, int p) const noexcept
+{
+    if (f <= 0)
+        return nullptr;
+
+    return stages[juce::jmin (f, maxFactorLog2) - 1][p == linearPhase ? linearPhase : minimumPhase].get();
+}
+
+//==============================================================================
+int AuricOversampler::getLatencySamples() const noexcept
+{
+    return getLatencySamplesFor (factorLog2, phase);
+}
+
+int AuricOversampler::getLatencySamplesFor (int f, int p) const noexcept
+{
+    if (f <= 0)
+        return 0;
+
+    f = juce::jmin (f, maxFactorLog2);
+    return latency[f - 1][p == linearPhase ? linearPhase : minimumPhase];
+}
+
+int AuricOversampler::getMaxLatencySamples() const noexcept
+{
+    int m = 0;
+
+    for (auto& f : latency)
+        for (auto l : f)
+            m = juce::jmax (m, l);
+
+    return m;
+}
@@ -0,0 +1,86 @@
+//==============================================================================
+// AuricOversampler.h  (AURIC Ω76) — polyphase half-band oversampling around
+// the nonlinear (drive) stage only
+//  - x2 / x4 cascades, minimum-phase (polyphase IIR) or linear-phase (FIR)
+//  - All four variants are built + allocated in prepare(); switching is a
+//    pointer swap + state reset, safe on the audio thread
+//  - processWith(): an older variant can keep running next to the current one
+//  - Latency is integer (base-rate samples) so the dry path can be aligned
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+class AuricOversampler
+{
+public:
+    enum Phase
+    {
+        minimumPhase = 0,
+        linearPhase
+    };
+
+    static constexpr int maxFactorLog2 = 2; // x4
+
+    AuricOversampler() = default;
+
+    void prepare (int numChannels, int maxBlockSize);
+    void reset() noexcept;
+
+    // factorLog2: 0 = x1 (bypass), 1 = x2, 2 = x4
+    void setMode (int factorLog2, int phase) noexcept;
+
+    int getFactorLog2() const noexcept { return factorLog2; }
+    int getFactor() const noexcept     { return 1 << factorLog2; }
+    int getPhase() const noexcept      { return phase; }
+
+    int getLatencySamples() const noexcept;
+    int getLatencySamplesFor (int factorLog2, int phase) const noexcept;
+    int getMaxLatencySamples() const noexcept;
+
+    // Runs fn (float* data, int numSamples) per channel at the oversampled rate.
+    template <typename NonLinearFn>
+    void process (float* const* channels, int numChannels, int numSamples, NonLinearFn&& fn) noexcept
+    {
+        processWith (factorLog2, phase, channels, numChannels, numSamples, fn);
+    }
+
+    // Same through any variant (the outgoing one while a mode change crossfades):
+    // each keeps its own filter state, so two can run side by side.
+    template <typename NonLinearFn>
+    void processWith (int variantFactorLog2, int variantPhase, float* const* channels, int numChannels,
+                      int numSamples, NonLinearFn&& fn) noexcept
+    {
+        auto* os = variant (variantFactorLog2, variantPhase);
+
+        if (os == nullptr)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                fn (channels[ch], numSamples);
+            return;
+        }
+
+        juce::dsp::AudioBlock<float> block (channels, (size_t) numChannels, (size_t) numSamples);
+        auto up = os->processSamplesUp (block);
+
+        for (size_t ch = 0; ch < (size_t) numChannels; ++ch)
+            fn (up.getChannelPointer (ch), (int) up.getNumSamples());
+
+        os->processSamplesDown (block);
+    }
+
+private:
+    using Oversampling = juce::dsp::Oversampling<float>;
+
+    Oversampling* current() const noexcept { return variant (factorLog2, phase); }
+    Oversampling* variant (int f, int p) const noexcept;
+
+    // [factorLog2 - 1][phase]
+    std::unique_ptr<Oversampling> stages[maxFactorLog2][2];
+    int latency[maxFactorLog2][2] {};
+
+    int factorLog2 { 0 };
+    int phase { minimumPhase };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricOversampler)
+};
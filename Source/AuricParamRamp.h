@@ -0,0 +1,146 @@
+//==============================================================================
+// AuricParamRamp.h  (AURIC Ω76) — per-sample parameter ramps as arrays
+//  - Block-rate target in, contiguous per-sample ramp out (kernel reads
+//    ramp[n] instead of a scalar, no per-sample "still smoothing?" test)
+//  - linear:         gains on a linear scale, mix amounts
+//  - multiplicative: straight line in log2 (dB, time constants), via fastExp2
+//  - Settled ramps generate nothing: next() returns nullptr, use getValue()
+//  - Control-rate users (filter cutoff) call advance(): one value per chunk
+//  - Block glide: a ramp never ends before the block that set it, so a host
+//    value (JUCE hands us the last automation point of the block) lands on
+//    the block end -> piecewise-linear automation at any buffer size
+//  - Storage allocated in prepare(), never in next()
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include "AuricFastMath.h"
+
+class AuricParamRamp
+{
+public:
+    enum Shape
+    {
+        linear = 0,
+        multiplicative    // values must stay > 0
+    };
+
+    explicit AuricParamRamp (Shape s) noexcept : shape (s) {}
+
+    void prepare (double sampleRate, double rampSeconds, int maxBlockSize)
+    {
+        rampLength = juce::jmax (1, juce::roundToInt (rampSeconds * sampleRate));
+        ramp.allocate ((size_t) juce::jmax (1, maxBlockSize), true);
+        maxBlock = juce::jmax (1, maxBlockSize);
+        reset (current);
+    }
+
+    // jump straight to v (first block, after bypass)
+    void reset (float v) noexcept
+    {
+        current = target = v;
+        stepsLeft = 0;
+    }
+
+    // glides over max (ramp time, blockLength) samples
+    void setTarget (float v, int blockLength = 0) noexcept
+    {
+        if (v == target)
+            return;
+
+        target = v;
+        length = juce::jmax (rampLength, blockLength);
+        stepsLeft = length;
+
+        // restarts from wherever the previous ramp had got to; the last
+        // point snaps to the exact target, so fastLog2 is plenty here
+        if (shape == multiplicative)
+        {
+            jassert (v > 0.0f && current > 0.0f);
+            start = AuricFastMath::fastLog2 (current);
+            step  = (AuricFastMath::fastLog2 (target) - start) / (float) length;
+        }
+        else
+        {
+            start = current;
+            step  = (target - current) / (float) length;
+        }
+    }
+
+    bool isSmoothing() const noexcept   { return stepsLeft > 0; }
+
+    // value after the last generated sample (== target once settled)
+    float getValue() const noexcept     { return current; }
+
+    // Ramp for the next numSamples, or nullptr when settled (caller uses getValue()).
+    const float* next (int numSamples) noexcept
+    {
+        if (stepsLeft <= 0)
+            return nullptr;
+
+        jassert (numSamples <= maxBlock);
+
+        float* out = ramp.get();
+        const int m = juce::jmin (numSamples, stepsLeft);
+        const float done = (float) (length - stepsLeft);
+
+        // every point is start + i * step (no running sum -> no drift, vectorizes)
+        if (shape == multiplicative)
+        {
+            for (int n = 0; n < m; ++n)
+                out[n] = AuricFastMath::fastExp2 (start + step * (done + (float) (n + 1)));
+        }
+        else
+        {
+            for (int n = 0; n < m; ++n)
+                out[n] = start + step * (done + (float) (n + 1));
+        }
+
+        stepsLeft -= m;
+
+        if (stepsLeft == 0)
+        {
+            // land exactly on the target
+            out[m - 1] = target;
+            juce::FloatVectorOperations::fill (out + m, target, numSamples - m);
+        }
+
+        current = out[m - 1];
+        return out;
+    }
+
+    // Moves on by numSamples without writing the ramp; value at the end of them
+    // (one exp2 per call instead of one per sample)
+    float advance (int numSamples) noexcept
+    {
+        if (stepsLeft <= 0)
+            return current;
+
+        stepsLeft -= juce::jmin (numSamples, stepsLeft);
+        const float done = (float) (length - stepsLeft);
+
+        if (stepsLeft == 0)
+            current = target;
+        else
+            current = (shape == multiplicative ? AuricFastMath::fastExp2 (start + step * done)
+                                               : start + step * done);
+        return current;
+    }
+
+private:
+    const Shape shape;
+
+    juce::HeapBlock<float> ramp;
+    int maxBlock { 1 };
+    int rampLength { 1 };   // minimum (smoothing time)
+    int length { 1 };       // running ramp
+    int stepsLeft { 0 };
+
+    float current { 0.0f };
+    float target { 0.0f };
+    float start { 0.0f };   // linear: value, multiplicative: log2 (value)
+    float step { 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE (AuricParamRamp)
+};
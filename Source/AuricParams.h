@@ -0,0 +1,137 @@
+//==============================================================================
+// AuricParams.h  (AURIC Ω76) — typed parameter table
+//  - One enum entry per APVTS parameter; the string ID lives only in `ids`
+//  - Raw value pointers are resolved once (constructor), never per block
+//  - processBlock reads everything in one go into a plain Snapshot
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+class AuricParams
+{
+public:
+    // order = ids[] order (layout order is free, lookups go through this)
+    enum Id
+    {
+        input = 0,
+        release,
+        edge,
+        mode,
+        mix,
+        omegaMix,
+        scHpf,
+        pwr,
+        omegaMode,
+        routing,
+        quality,
+        osPhase,
+        cpuGuard,
+        scMode,
+        scLink,
+        lookahead,
+        detMode,
+        rmsWindow,
+        scShape,
+        scFreq,
+        multiband,
+        xoverLow,
+        xoverHigh,
+        detEco,
+        driveAa,
+        numParams
+    };
+
+    static constexpr const char* ids[numParams] =
+    {
+        "input", "release", "edge", "mode", "mix", "omega_mix",
+        "sc_hpf", "pwr", "omega_mode", "routing", "quality", "os_phase", "cpu_guard",
+        "sc_mode", "sc_link", "lookahead", "det_mode", "rms_window", "sc_shape", "sc_freq",
+        "multiband", "xover_lo", "xover_hi", "det_eco", "drive_aa"
+    };
+
+    static juce::ParameterID parameterId (Id id)       { return { ids[id], 1 }; }
+
+    // Everything the audio thread needs from APVTS for one block
+    struct Snapshot
+    {
+        float inputDb   = 0.0f;
+        float releaseMs = 150.0f;
+        float edge      = 0.0f;     // 0..1
+        float mode      = 0.5f;     // 0..1
+        float mix       = 1.0f;     // 0..1
+        float omegaMix  = 1.0f;     // 0..1
+        bool  scHpf     = false;
+        bool  pwr       = true;
+        int   omegaMode = 0;        // 0 clean, 1 iron, 2 grit
+        int   routing   = 0;        // 0 A, 1 D, 2 Ω
+        int   quality   = 0;
+        int   osPhase   = 0;        // 0 min, 1 linear
+        bool  cpuGuard  = false;
+        int   scMode    = 0;        // 0 L+R (linked), 1 L/R, 2 M/S
+        float scLink    = 0.0f;     // 0..1
+        float lookaheadMs = 0.0f;   // 0..10 ms
+        int   detMode   = 0;        // 0 peak, 1 RMS, 2 peak + RMS
+        float rmsWindowMs = 10.0f;  // 1..100 ms
+        int   scShape   = 0;        // 0 HPF, 1 BPF, 2 tilt
+        float scFreq    = 120.0f;   // Hz
+        bool  multiband = false;
+        float xoverLow  = 200.0f;   // Hz
+        float xoverHigh = 2500.0f;  // Hz
+        bool  detEco    = false;    // detector at control rate (always on above 96 kHz)
+        int   driveAa   = 0;        // 0 off, 1 ADAA1, 2 ADAA2 (only while the drive runs x1)
+    };
+
+    AuricParams() = default;
+
+    // message thread, once the APVTS exists
+    void resolve (juce::AudioProcessorValueTreeState& apvts)
+    {
+        for (int i = 0; i < numParams; ++i)
+        {
+            raw[i] = apvts.getRawParameterValue (ids[i]);
+            jassert (raw[i] != nullptr);   // ids[] out of sync with createParameterLayout()
+        }
+    }
+
+    // any thread, lock-free (relaxed loads; each value is independent anyway)
+    Snapshot read() const noexcept
+    {
+        Snapshot s;
+        s.inputDb   = get (input);
+        s.releaseMs = get (release);
+        s.edge      = get (edge);
+        s.mode      = get (mode);
+        s.mix       = get (mix);
+        s.omegaMix  = get (omegaMix);
+        s.scHpf     = getBool (scHpf);
+        s.pwr       = getBool (pwr);
+        s.omegaMode = getChoice (omegaMode);
+        s.routing   = getChoice (routing);
+        s.quality   = getChoice (quality);
+        s.osPhase   = getChoice (osPhase);
+        s.cpuGuard  = getBool (cpuGuard);
+        s.scMode    = getChoice (scMode);
+        s.scLink    = get (scLink);
+        s.lookaheadMs = get (lookahead);
+        s.detMode   = getChoice (detMode);
+        s.rmsWindowMs = get (rmsWindow);
+        s.scShape   = getChoice (scShape);
+        s.scFreq    = get (scFreq);
+        s.multiband = getBool (multiband);
+        s.xoverLow  = get (xoverLow);
+        s.xoverHigh = get (xoverHigh);
+        s.detEco    = getBool (detEco);
+        s.driveAa   = getChoice (driveAa);
+        return s;
+    }
+
+    float get (Id id) const noexcept        { return raw[id]->load (std::memory_order_relaxed); }
+    bool  getBool (Id id) const noexcept    { return get (id) >= 0.5f; }
+    int   getChoice (Id id) const noexcept  { return (int) juce::jlimit (0.0f, 1000.0f, get (id)); }
+
+private:
+    std::atomic<float>* raw[numParams] {};
+
+    JUCE_DECLARE_NON_COPYABLE (AuricParams)
+};
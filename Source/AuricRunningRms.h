@@ -0,0 +1,108 @@
+//==============================================================================
+// AuricRunningRms.h  (AURIC Ω76) — windowed RMS from a running sum of squares
+//  - One add + one subtract per sample whatever the window length
+//  - Sum re-added from the ring once per window (drift never builds up),
+//    amortized one extra add per sample
+//  - Window changes only add/remove the squares entering/leaving the window
+//    (history kept, no restart)
+//  - Ring sized once in prepare(), no allocation in process()
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include <cmath>
+
+class AuricRunningRms
+{
+public:
+    AuricRunningRms() = default;
+
+    void prepare (int maxWindowSamples)
+    {
+        maxWindow = juce::jmax (1, maxWindowSamples);
+        window = juce::jlimit (1, maxWindow, window);
+        mask = juce::nextPowerOfTwo (maxWindow) - 1;
+
+        squares.allocate ((size_t) mask + 1, true);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        juce::FloatVectorOperations::clear (squares.get(), mask + 1);
+        sum = 0.0;
+        writePos = 0;
+        sinceResync = 0;
+    }
+
+    void setWindow (int samples) noexcept
+    {
+        samples = juce::jlimit (1, maxWindow, samples);
+
+        while (window < samples)
+        {
+            ++window;
+            sum += squares[(writePos - window) & mask];
+        }
+
+        while (window > samples)
+        {
+            sum -= squares[(writePos - window) & mask];
+            --window;
+        }
+    }
+
+    int getWindow() const noexcept { return window; }
+
+    // In place: io[n] = sqrt (mean of io^2 over the last `window` samples)
+    void process (float* io, int numSamples) noexcept
+    {
+        const double invWindow = 1.0 / (double) window;
+
+        for (int n = 0; n < numSamples;)
+        {
+            // run up to the next resync point, no per-sample test
+            const int todo = juce::jmin (numSamples - n, juce::jmax (0, window - sinceResync));
+
+            for (int i = n; i < n + todo; ++i)
+            {
+                const float sq = io[i] * io[i];
+                sum += (double) sq - (double) squares[(writePos - window) & mask];
+                squares[writePos] = sq;
+                writePos = (writePos + 1) & mask;
+
+                io[i] = (float) std::sqrt (juce::jmax (0.0, sum * invWindow));
+            }
+
+            n += todo;
+            sinceResync += todo;
+
+            if (sinceResync >= window)
+                resync();
+        }
+    }
+
+private:
+    // exact sum of the live window (once per window length)
+    void resync() noexcept
+    {
+        double s = 0.0;
+        for (int k = 1; k <= window; ++k)
+            s += squares[(writePos - k) & mask];
+
+        sum = s;
+        sinceResync = 0;
+    }
+
+    juce::HeapBlock<float> squares;
+    double sum { 0.0 };
+
+    int mask { 0 };
+    int maxWindow { 1 };
+    int window { 1 };
+    int writePos { 0 };
+    int sinceResync { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricRunningRms)
+};
@@ -0,0 +1,313 @@
+//==============================================================================
+// AuricSaturator.h  (AURIC Ω76) — atan drive with fast, bounded approximations
+//  y = atan (x * drive * hard) / atan (hard)
+//
+//  atan family (|x| > 1 folded via atan(x) = pi/2 - atan(1/x), branch-free):
+//      approx        max |err| vs std::atan     (float, full real line)
+//      atanPoly3      6.13e-3   (~ -44 dB)       odd poly, 2 terms  (Remez)
+//      atanPoly5      7.04e-4   (~ -63 dB)       odd poly, 3 terms  (Remez)
+//      atanPoly7      9.09e-5   (~ -81 dB)       odd poly, 4 terms  (Remez)
+//      atanPoly11     1.94e-6   (~-114 dB)       odd poly, 6 terms  (Remez)
+//      atanLut256     1.40e-6   (~-117 dB)       257-pt constexpr table, linear interp
+//  The polynomials are fitted with p(1) = pi/4 pinned (constrained Remez,
+//  c0 nudged to land it in float), so the fold is continuous at |x| = 1: an
+//  unpinned fit jumps there by 2 * its endpoint error (1e-2 for order 3).
+//  Output error is at most err / atan(hard) <= 1.28 * err (hard >= 1).
+//  Error report + timings: Tests/Source/AuricSaturatorTests.cpp
+//
+//  Voicing<OmegaMode> holds the CLEAN/IRON/GRIT drive boost and picks the
+//  approximation at compile time.
+//
+//  The kernels only shape: x = atan (x). The engine applies the input gain
+//  k = driveBase * boost * hard and the output gain 1 / atan(hard) as
+//  per-sample ramps around them (base rate, outside the oversampler).
+//
+//  AdaaAtan: 1st / 2nd order antiderivative anti-aliasing of the same curve
+//  at base rate (no oversampling). Group delay 0.5 / 1 sample.
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+// 1 = CLEAN uses the LUT instead of the 11th-order polynomial
+#ifndef AURIC_SATURATOR_USE_LUT
+ #define AURIC_SATURATOR_USE_LUT 0
+#endif
+
+namespace AuricSaturator
+{
+    enum AtanApprox
+    {
+        atanPoly3 = 0,
+        atanPoly5,
+        atanPoly7,
+        atanPoly11,
+        atanLut256,
+        atanExact
+    };
+
+    //==========================================================================
+    namespace detail
+    {
+        // Euler's series, converges on the whole line; compile time only
+        constexpr double atanSeries (double x)
+        {
+            const double x2 = x * x;
+            const double q  = x2 / (1.0 + x2);
+            double term = x / (1.0 + x2);
+            double sum  = term;
+
+            for (int n = 1; n < 64; ++n)
+            {
+                term *= q * (2.0 * n) / (2.0 * n + 1.0);
+                sum  += term;
+            }
+
+            return sum;
+        }
+
+        template <int N>
+        struct AtanTable
+        {
+            static constexpr int size = N;
+
+            constexpr AtanTable() : v()
+            {
+                for (int i = 0; i <= N; ++i)
+                    v[i] = (float) atanSeries ((double) i / (double) N);
+            }
+
+            float v[N + 1];
+        };
+
+        inline constexpr AtanTable<256> atanTable {};
+
+        // atan on t in [0, 1]
+        template <int Approx>
+        inline float atanUnit (float t) noexcept
+        {
+            const float t2 = t * t;
+
+            if constexpr (Approx == atanPoly3)
+                return t * (0.967482567f - 0.182084382f * t2);
+
+            if constexpr (Approx == atanPoly5)
+                return t * (0.994766057f + t2 * (-0.285434186f + t2 * 0.076066315f));
+
+            if constexpr (Approx == atanPoly7)
+                return t * (0.999135971f + t2 * (-0.320366859f + t2 * (0.144291282f + t2 * -0.037662193f)));
+
+            if constexpr (Approx == atanPoly11)
+                return t * (0.999975681f + t2 * (-0.332585186f + t2 * (0.193293691f
+                          + t2 * (-0.115781970f + t2 * (0.051923487f + t2 * -0.011427526f)))));
+
+            if constexpr (Approx == atanLut256)
+            {
+                constexpr int N = decltype (atanTable)::size;
+                const float idx = t * (float) N;
+                const int i = juce::jmin ((int) idx, N - 1);
+                const float frac = idx - (float) i;
+                return atanTable.v[i] + frac * (atanTable.v[i + 1] - atanTable.v[i]);
+            }
+
+            return 0.0f;
+        }
+    }
+
+    //==========================================================================
+    template <int Approx>
+    inline float atan (float x) noexcept
+    {
+        if constexpr (Approx == atanExact)
+        {
+            return std::atan (x);
+        }
+        else
+        {
+            // fold |x| > 1 with a 0/1 blend, not a branch/select: gcc won't
+            // if-convert a float ternary without -ffast-math, this vectorizes
+            const float ax  = std::abs (x);
+            const float big = (float) (ax > 1.0f);
+            const float t   = (ax + big * (1.0f - ax)) / (1.0f + big * (ax - 1.0f));   // min/max
+
+            float y = detail::atanUnit<Approx> (t);
+            y += big * (juce::MathConstants<float>::halfPi - 2.0f * y);
+
+            return std::copysign (y, x);
+        }
+    }
+
+    //==========================================================================
+    // 0 CLEAN, 1 IRON, 2 GRIT
+    template <int OmegaMode> struct Voicing;
+
+    template <> struct Voicing<0>
+    {
+        static constexpr float driveBoost = 1.0f;
+       #if AURIC_SATURATOR_USE_LUT
+        static constexpr int approx = atanLut256;
+       #else
+        static constexpr int approx = atanPoly11;   // gentle drive: error would be exposed
+       #endif
+    };
+
+    template <> struct Voicing<1>
+    {
+        static constexpr float driveBoost = 1.35f;
+        static constexpr int approx = atanPoly7;    // harmonics mask -81 dB
+    };
+
+    template <> struct Voicing<2>
+    {
+        static constexpr float driveBoost = 1.8f;
+        static constexpr int approx = atanPoly7;
+    };
+
+    // cheapest tier, used when the CPU governor asks for it
+    static constexpr int ecoApprox = atanPoly5;
+
+    //==========================================================================
+    // In place, x = atan (x) (already scaled by k, unnormalised)
+    template <int Approx>
+    inline void shape (float* x, int numSamples) noexcept
+    {
+        for (int n = 0; n < numSamples; ++n)
+            x[n] = atan<Approx> (x[n]);
+    }
+
+    inline float driveBoostFor (int omegaMode) noexcept
+    {
+        return omegaMode == 1 ? Voicing<1>::driveBoost
+             : omegaMode == 2 ? Voicing<2>::driveBoost
+                              : Voicing<0>::driveBoost;
+    }
+
+    inline int approxFor (int omegaMode, bool eco) noexcept
+    {
+        if (eco)
+            return ecoApprox;
+
+        return omegaMode == 1 ? Voicing<1>::approx
+             : omegaMode == 2 ? Voicing<2>::approx
+                              : Voicing<0>::approx;
+    }
+
+    // runtime -> template dispatch (block rate)
+    inline void shape (float* x, int numSamples, int approx) noexcept
+    {
+        switch (approx)
+        {
+            case atanPoly3:   shape<atanPoly3>  (x, numSamples); break;
+            case atanPoly5:   shape<atanPoly5>  (x, numSamples); break;
+            case atanPoly7:   shape<atanPoly7>  (x, numSamples); break;
+            case atanPoly11:  shape<atanPoly11> (x, numSamples); break;
+            case atanLut256:  shape<atanLut256> (x, numSamples); break;
+            default:          shape<atanExact>  (x, numSamples); break;
+        }
+    }
+
+    // output gain 1 / atan(hard), same approximant as the shaper so x * k == hard maps to 1
+    inline float normFor (int approx, float hard) noexcept
+    {
+        float h = hard;
+        shape (&h, 1, approx);
+        return 1.0f / h;
+    }
+
+    //==========================================================================
+    // f(v)  = atan (v)      (input already scaled by k)
+    // F1(v) = v atan(v) - ln(1 + v^2) / 2
+    // F2(v) = ((v^2 - 1) atan(v) + v - v ln(1 + v^2)) / 2
+    // Divided differences cancel hard -> double + std:: functions inside;
+    // near-equal inputs fall back to the midpoint (ill-conditioned case).
+    // Order is fixed between reset() calls (the engine swaps it behind a fade).
+    class AdaaAtan
+    {
+    public:
+        static int getLatencySamples (int order) noexcept  { return order >= 2 ? 1 : 0; }
+
+        void reset() noexcept
+        {
+            x1 = x2 = 0.0;
+            ad1x1 = ad2x1 = d1 = 0.0;
+        }
+
+        void process (float* x, int numSamples, int order) noexcept
+        {
+            if (order >= 2)
+                processSecondOrder (x, numSamples);
+            else
+                processFirstOrder (x, numSamples);
+        }
+
+    private:
+        // in k-scaled units (k up to ~56): F2 ~ v^2 / 2, keeps the 2nd difference well above rounding
+        static constexpr double tol = 1.0e-3;
+
+        static double f   (double v) noexcept { return std::atan (v); }
+        static double ad1 (double v) noexcept { return v * std::atan (v) - 0.5 * std::log1p (v * v); }
+        static double ad2 (double v) noexcept
+        {
+            return 0.5 * ((v * v - 1.0) * std::atan (v) + v - v * std::log1p (v * v));
+        }
+
+        // first divided difference of F2 against the previous input
+        double d2 (double x0, double ad2x0) const noexcept
+        {
+            return std::abs (x0 - x1) < tol ? ad1 (0.5 * (x0 + x1)) : (ad2x0 - ad2x1) / (x0 - x1);
+        }
+
+        void processFirstOrder (float* x, int numSamples) noexcept
+        {
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const double x0 = (double) x[n];
+                const double ad1x0 = ad1 (x0);
+
+                const double y = std::abs (x0 - x1) < tol ? f (0.5 * (x0 + x1))
+                                                          : (ad1x0 - ad1x1) / (x0 - x1);
+                x[n] = (float) y;
+
+                x2 = x1;
+                x1 = x0;
+                ad1x1 = ad1x0;
+            }
+        }
+
+        void processSecondOrder (float* x, int numSamples) noexcept
+        {
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const double x0 = (double) x[n];
+                const double ad2x0 = ad2 (x0);
+                const double d0 = d2 (x0, ad2x0);
+
+                double y;
+
+                if (std::abs (x0 - x2) >= tol)
+                {
+                    y = 2.0 * (d0 - d1) / (x0 - x2);
+                }
+                else
+                {
+                    // x0 ~ x2: confluent divided difference around xBar
+                    const double xBar  = 0.5 * (x0 + x2);
+                    const double delta = xBar - x1;
+
+                    y = std::abs (delta) < tol ? f (0.5 * (xBar + x1))
+                                               : (2.0 / delta) * (ad1 (xBar) + (ad2x1 - ad2 (xBar)) / delta);
+                }
+
+                x[n] = (float) y;
+
+                x2 = x1;
+                x1 = x0;
+                ad2x1 = ad2x0;
+                d1 = d0;
+            }
+        }
+
+        double x1 { 0.0 }, x2 { 0.0 };
+        double ad1x1 { 0.0 }, ad2x1 { 0.0 }, d1 { 0.0 };
+    };
+}
@@ -0,0 +1,89 @@
+//==============================================================================
+// AuricSlidingMax.h  (AURIC Ω76) — running maximum over the last N+1 samples
+//  - Monotonic deque (values only ever decrease front -> back): each sample
+//    is pushed and popped at most once -> O(1) amortized, whatever N is
+//  - Ring storage sized once in prepare(), no allocation in process()
+//  - Lookahead peak: the detector sees the loudest sample of the window
+//    the (delayed) audio is about to play
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include <cstdint>
+
+class AuricSlidingMax
+{
+public:
+    AuricSlidingMax() = default;
+
+    void prepare (int maxWindowSamples)
+    {
+        maxWindow = juce::jmax (0, maxWindowSamples);
+        window = juce::jmin (window, maxWindow);
+        capacity = juce::nextPowerOfTwo (maxWindow + 2);   // window + 1 live, + the one being pushed
+        mask = capacity - 1;
+
+        values.allocate ((size_t) capacity, true);
+        stamps.allocate ((size_t) capacity, true);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        head = tail = 0;
+        now = 0;
+    }
+
+    // max over the current sample and the `samples` before it (0 = pass-through)
+    void setWindow (int samples) noexcept
+    {
+        window = juce::jlimit (0, maxWindow, samples);
+
+        // shrunk while running: drop what already fell out (process() pops one per sample)
+        while (head != tail && now - stamps[head & mask] > (uint32_t) window)
+            ++head;
+    }
+    int  getWindow() const noexcept         { return window; }
+
+    // In place: io[n] = max (io[n - window] .. io[n])
+    void process (float* io, int numSamples) noexcept
+    {
+        if (window <= 0)
+            return;
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float x = io[n];
+
+            // anything not louder than x can never be the max again
+            while (tail != head && values[(tail - 1) & mask] <= x)
+                --tail;
+
+            values[tail & mask] = x;
+            stamps[tail & mask] = now;
+            ++tail;
+
+            // one in, so at most one falls out of the window
+            if (now - stamps[head & mask] > (uint32_t) window)
+                ++head;
+
+            io[n] = values[head & mask];
+            ++now;
+        }
+    }
+
+private:
+    juce::HeapBlock<float> values;
+    juce::HeapBlock<uint32_t> stamps;   // sample counter, wraps harmlessly (differences only)
+
+    int capacity { 1 };
+    int mask { 0 };
+    int maxWindow { 0 };
+    int window { 0 };
+
+    uint32_t head { 0 }, tail { 0 };    // deque = [head, tail), masked into the ring
+    uint32_t now { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricSlidingMax)
+};
@@ -0,0 +1,462 @@
+//==============================================================================
+// AuricSvf.h  (AURIC Ω76) — TPT state-variable filter for the detector path
+//  - Trapezoidal (zero-delay-feedback) SVF: stays stable while the cutoff
+//    moves, same response as a bilinear biquad when it doesn't
+//  - Channels are SIMD lanes: stereo (or 4 ch) = one register, one recursion;
+//    rows are transposed per chunk (not per sample) into an aligned frame buffer
+//  - Integrator update written as its 2x2 state-space step: the recursion is
+//    one multiply-add deep, the output hangs off it
+//  - Shapes: HPF (Q 0.707), band-pass (0 dB peak), tilt (-6 dB lows,
+//    +6 dB highs around the cutoff); Butterworth low-pass + all-pass for the
+//    crossover (AuricCrossover)
+//  - Optional second output (another shape off the same state): a low-pass
+//    and an all-pass of one cutoff cost one recursion, not two
+//  - Settled mono / stereo (lanes to spare): scattered look-ahead instead,
+//    the lanes carry 4 consecutive samples of one channel and the state
+//    jumps 4 samples per step (block matrices precomputed with the design)
+//  - Coefficients are designed at control rate (setTarget, once per chunk)
+//    and glided linearly across the next process() call in 8-sample steps:
+//    a moving cutoff costs no tan() per sample and never jumps
+//  - State + frames sized in prepare(), nothing allocated in process()
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cmath>
+
+class AuricSvf
+{
+public:
+    enum Shape
+    {
+        highPass = 0,
+        bandPass,
+        tilt,
+        lowPass,        // crossover sections (not on the SC SHAPE switch)
+        allPass,
+        numShapes
+    };
+
+    static constexpr int maxChannels = 16;
+
+    AuricSvf() = default;
+
+    void prepare (double sampleRate, int maxBlockSize)
+    {
+        sr = sampleRate;
+        maxBlock = juce::jmax (1, maxBlockSize);
+        frames.allocate ((size_t) (2 * maxBlock * lanes) + Vec::SIMDNumElements, true);   // output + second output, + align slack
+        frameData = Vec::getNextSIMDAlignedPtr (frames.get());
+        design (targetHz, targetShape, targetShape2, target, targetBlock);
+        reset();
+    }
+
+    // clears the state, coefficients jump to the target
+    void reset() noexcept
+    {
+        for (int g = 0; g < maxGroups; ++g)
+            ic1[g] = ic2[g] = Vec::expand (0.0f);
+
+        current = target;
+    }
+
+    // control rate: the next process() glides from the current coefficients to these;
+    // secondShape (>= 0) feeds process()'s out2 (tilt moves the state, so first shape only)
+    void setTarget (float cutoffHz, int shape, int secondShape = -1) noexcept
+    {
+        if (cutoffHz == targetHz && shape == targetShape && secondShape == targetShape2)
+            return;
+
+        jassert (secondShape != tilt);
+
+        targetHz = cutoffHz;
+        targetShape = shape;
+        targetShape2 = secondShape;
+        design (cutoffHz, shape, secondShape, target, targetBlock);
+    }
+
+    // out2 = the second shape (nullptr = not needed); out / out2 may alias in
+    void process (const float* const* in, float* const* out, int numChannels, int numSamples,
+                  float* const* out2 = nullptr) noexcept
+    {
+        jassert (numChannels <= maxChannels && numSamples <= maxBlock);
+        jassert (out2 == nullptr || targetShape2 >= 0);
+
+        if (numSamples <= 0)
+            return;
+
+        if (out2 != nullptr)
+            processAll<true> (in, out, out2, numChannels, numSamples);
+        else
+            processAll<false> (in, out, out, numChannels, numSamples);
+    }
+
+private:
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static constexpr int lanes = (int) Vec::SIMDNumElements;
+    static constexpr int maxGroups = (maxChannels + lanes - 1) / lanes;
+
+    // ZDF solve: v1 = a1 s1 + a2 (x - s2), v2 = s2 + a2 s1 + a3 (x - s2)
+    // s1' = 2 v1 - s1, s2' = 2 v2 - s2  ->  s' = [k11 k12; k21 k22] s + [b1; b2] x
+    // y = m0 x + m1 v1 + m2 v2          ->  y  = cx x + c1 s1 + c2 s2  (second output: *B)
+    enum Term { k11 = 0, k12, k21, k22, b1, b2, cx, c1, c2, cxB, c1B, c2B, numTerms };
+
+    struct Coeffs
+    {
+        float t[numTerms] { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+        bool operator== (const Coeffs& o) const noexcept { return std::equal (t, t + numTerms, o.t); }
+    };
+
+    // scattered look-ahead, one channel, `lanes` samples per step (lane j = sample n + j):
+    //   y[n..n+L) = sum_i tCol[i] x[n + i] + p1 s1[n] + p2 s2[n]   (per output)
+    //   s[n + L]  = sum_i qCol[i] x[n + i] + kl1 s1[n] + kl2 s2[n]   (lanes 0 / 1)
+    struct BlockOutput
+    {
+        Vec tCol[lanes], p1, p2;
+    };
+
+    struct BlockCoeffs
+    {
+        BlockOutput y[2];
+        Vec qCol[lanes], kl1, kl2;
+    };
+
+    // coefficient steps while gliding (the inner loop never changes them)
+    static constexpr int glideStep = 8;
+
+    // output mix for one shape (tilt also scales g, see design())
+    static void outputMix (int shape, double k, double& m0, double& m1, double& m2) noexcept
+    {
+        m0 = 1.0;
+        m1 = m2 = 0.0;
+
+        if (shape == bandPass)
+        {
+            m0 = 0.0;
+            m1 = k;
+        }
+        else if (shape == tilt)
+        {
+            // +12 dB high shelf, whole curve pulled down 6 dB
+            const double A = tiltGain();
+            m0 = A;
+            m1 = k * (1.0 - A);
+            m2 = (1.0 - A * A) / A;
+        }
+        else if (shape == lowPass)
+        {
+            m0 = 0.0;
+            m2 = 1.0;
+        }
+        else if (shape == allPass)
+        {
+            m1 = -2.0 * k;
+        }
+        else
+        {
+            m1 = -k;
+            m2 = -1.0;
+        }
+    }
+
+    static double tiltGain() noexcept { return std::pow (10.0, 12.0 / 40.0); }
+
+    void design (float cutoffHz, int shape, int secondShape, Coeffs& c, BlockCoeffs& bc) const noexcept
+    {
+        const double fc = juce::jlimit (10.0, 0.45 * sr, (double) cutoffHz);
+        const double k  = juce::MathConstants<double>::sqrt2;   // Q 0.707
+        double g = std::tan (juce::MathConstants<double>::pi * fc / sr);
+
+        if (shape == tilt)
+            g *= std::sqrt (tiltGain());
+
+        const double a1 = 1.0 / (1.0 + g * (g + k));
+        const double a2 = g * a1;
+        const double a3 = g * a2;
+
+        double d[numTerms];
+        d[k11] = 2.0 * a1 - 1.0;
+        d[k12] = -2.0 * a2;
+        d[k21] = 2.0 * a2;
+        d[k22] = 1.0 - 2.0 * a3;
+        d[b1]  = 2.0 * a2;
+        d[b2]  = 2.0 * a3;
+
+        // both outputs off the same state
+        const int shapes[2] = { shape, secondShape >= 0 ? secondShape : shape };
+
+        for (int o = 0; o < 2; ++o)
+        {
+            double m0, m1, m2;
+            outputMix (shapes[o], k, m0, m1, m2);
+
+            double* y = d + (o == 0 ? cx : cxB);
+            y[0] = m0 + m1 * a2 + m2 * a3;
+            y[1] = m1 * a1 + m2 * a2;
+            y[2] = m2 * (1.0 - a3) - m1 * a2;
+        }
+
+        for (int i = 0; i < numTerms; ++i)
+            c.t[i] = (float) d[i];
+
+        designBlock (d, bc);
+    }
+
+    // powers of the state matrix, in double, rounded once at the end
+    static void designBlock (const double* d, BlockCoeffs& bc) noexcept
+    {
+        // kp[j] = K^j (row-major 2x2)
+        double kp[lanes + 1][4] { { 1.0, 0.0, 0.0, 1.0 } };
+
+        for (int j = 0; j < lanes; ++j)
+        {
+            const double* m = kp[j];
+            kp[j + 1][0] = d[k11] * m[0] + d[k12] * m[2];
+            kp[j + 1][1] = d[k11] * m[1] + d[k12] * m[3];
+            kp[j + 1][2] = d[k21] * m[0] + d[k22] * m[2];
+            kp[j + 1][3] = d[k21] * m[1] + d[k22] * m[3];
+        }
+
+        const auto Kb = [&] (int j, int row) { return kp[j][2 * row] * d[b1] + kp[j][2 * row + 1] * d[b2]; };
+
+        alignas (sizeof (Vec)) float v[lanes];
+        const auto load = [&v] { return Vec::fromRawArray (v); };
+
+        for (int o = 0; o < 2; ++o)
+        {
+            // c K^j (c = this output's state terms)
+            const double* y = d + (o == 0 ? cx : cxB);
+            const auto cK = [&] (int j, int col) { return y[1] * kp[j][col] + y[2] * kp[j][2 + col]; };
+            auto& out = bc.y[o];
+
+            // x[n + i] reaches y[n + j] through c K^(j-1-i) b, directly (cx) at j == i
+            for (int i = 0; i < lanes; ++i)
+            {
+                for (int j = 0; j < lanes; ++j)
+                    v[j] = (float) (j == i ? y[0] : j > i ? cK (j - 1 - i, 0) * d[b1] + cK (j - 1 - i, 1) * d[b2] : 0.0);
+                out.tCol[i] = load();
+            }
+
+            for (int j = 0; j < lanes; ++j) v[j] = (float) cK (j, 0);
+            out.p1 = load();
+            for (int j = 0; j < lanes; ++j) v[j] = (float) cK (j, 1);
+            out.p2 = load();
+        }
+
+        for (int i = 0; i < lanes; ++i)
+        {
+            for (int j = 0; j < lanes; ++j)
+                v[j] = (float) (j < 2 ? Kb (lanes - 1 - i, j) : 0.0);
+            bc.qCol[i] = load();
+        }
+
+        for (int j = 0; j < lanes; ++j) v[j] = (float) (j < 2 ? kp[lanes][2 * j]     : 0.0);
+        bc.kl1 = load();
+        for (int j = 0; j < lanes; ++j) v[j] = (float) (j < 2 ? kp[lanes][2 * j + 1] : 0.0);
+        bc.kl2 = load();
+    }
+
+    template <bool Dual>
+    void processAll (const float* const* in, float* const* out, float* const* out2, int numChannels,
+                     int numSamples) noexcept
+    {
+        const bool glide = ! (current == target);
+
+        // too few channels to fill the lanes: spend them on time instead
+        if (! glide && numChannels <= 2)
+        {
+            if (numChannels == 1)
+                processBlocked<1, Dual> (in, out, out2, numSamples);
+            else
+                processBlocked<2, Dual> (in, out, out2, numSamples);
+
+            return;
+        }
+
+        for (int first = 0, g = 0; first < numChannels; first += lanes, ++g)
+        {
+            const int numLanes = juce::jmin (lanes, numChannels - first);
+
+            if (glide)
+                processGroup<true,  Dual> (g, in + first, out + first, out2 + first, numLanes, numSamples);
+            else
+                processGroup<false, Dual> (g, in + first, out + first, out2 + first, numLanes, numSamples);
+        }
+
+        current = target;
+    }
+
+    // settled, NumCh (1 / 2) channels, each stepped `lanes` samples at a time;
+    // state lives in the same lanes as the channel-lane path (either can follow)
+    template <int NumCh, bool Dual>
+    void processBlocked (const float* const* in, float* const* out, float* const* out2, int numSamples) noexcept
+    {
+        const auto& bc = targetBlock;
+        alignas (sizeof (Vec)) float y[lanes];
+        float s1[NumCh], s2[NumCh];
+
+        for (int ch = 0; ch < NumCh; ++ch)
+        {
+            s1[ch] = ic1[0].get ((size_t) ch);
+            s2[ch] = ic2[0].get ((size_t) ch);
+        }
+
+        int n = 0;
+
+        for (; n + lanes <= numSamples; n += lanes)
+        {
+            // channels interleaved: two independent chains in flight
+            for (int ch = 0; ch < NumCh; ++ch)
+            {
+                const float* x = in[ch] + n;
+                const Vec a = Vec::expand (s1[ch]), b = Vec::expand (s2[ch]);
+                Vec yv = bc.y[0].p1 * a + bc.y[0].p2 * b;
+                Vec yv2 = Dual ? bc.y[1].p1 * a + bc.y[1].p2 * b : yv;
+                Vec sv = bc.kl1 * a + bc.kl2 * b;
+
+                for (int i = 0; i < lanes; ++i)
+                {
+                    const Vec xi = Vec::expand (x[i]);
+                    yv += bc.y[0].tCol[i] * xi;
+                    sv += bc.qCol[i] * xi;
+
+                    if constexpr (Dual)
+                        yv2 += bc.y[1].tCol[i] * xi;
+                }
+
+                s1[ch] = sv.get (0);
+                s2[ch] = sv.get (1);
+
+                // x is fully read: safe to write over it now
+                yv.copyToRawArray (y);
+                std::copy (y, y + lanes, out[ch] + n);
+
+                if constexpr (Dual)
+                {
+                    yv2.copyToRawArray (y);
+                    std::copy (y, y + lanes, out2[ch] + n);
+                }
+            }
+        }
+
+        // tail: plain scalar steps
+        const auto& c = target.t;
+
+        for (; n < numSamples; ++n)
+        {
+            for (int ch = 0; ch < NumCh; ++ch)
+            {
+                const float x = in[ch][n];
+                const float a = s1[ch], b = s2[ch];
+                out[ch][n] = c[cx] * x + c[c1] * a + c[c2] * b;
+
+                if constexpr (Dual)
+                    out2[ch][n] = c[cxB] * x + c[c1B] * a + c[c2B] * b;
+
+                s1[ch] = c[k11] * a + c[k12] * b + c[b1] * x;
+                s2[ch] = c[k21] * a + c[k22] * b + c[b2] * x;
+            }
+        }
+
+        for (int ch = 0; ch < NumCh; ++ch)
+        {
+            ic1[0].set ((size_t) ch, s1[ch]);
+            ic2[0].set ((size_t) ch, s2[ch]);
+        }
+    }
+
+    // constant coefficients over [from, to) of the frame buffer (f2: second output)
+    template <bool Dual>
+    static void run (const Vec* c, Vec& s1, Vec& s2, float* f, float* f2, int from, int to) noexcept
+    {
+        for (int n = from; n < to; ++n)
+        {
+            const Vec x = Vec::fromRawArray (f + n * lanes);
+            const Vec y = c[cx] * x + c[c1] * s1 + c[c2] * s2;
+
+            if constexpr (Dual)
+                (c[cxB] * x + c[c1B] * s1 + c[c2B] * s2).copyToRawArray (f2 + n * lanes);
+
+            // the recursion itself: one multiply-add deep
+            const Vec n1 = c[k11] * s1 + c[k12] * s2 + c[b1] * x;
+            const Vec n2 = c[k21] * s1 + c[k22] * s2 + c[b2] * x;
+            s1 = n1;
+            s2 = n2;
+
+            y.copyToRawArray (f + n * lanes);
+        }
+    }
+
+    template <bool Glide, bool Dual>
+    void processGroup (int g, const float* const* in, float* const* out, float* const* out2, int numLanes,
+                       int numSamples) noexcept
+    {
+        // planar rows -> one register per sample (unused lanes stay 0)
+        float* f = frameData;
+        float* f2 = f + maxBlock * lanes;
+
+        if (numLanes < lanes)
+            juce::FloatVectorOperations::clear (f, numSamples * lanes);
+
+        for (int l = 0; l < numLanes; ++l)
+            for (int n = 0; n < numSamples; ++n)
+                f[n * lanes + l] = in[l][n];
+
+        Vec c[numTerms];
+        Vec s1 = ic1[g], s2 = ic2[g];
+
+        if constexpr (Glide)
+        {
+            // step j of m uses current + j / m * (target - current): the last one is the target
+            const int numSteps = (numSamples + glideStep - 1) / glideStep;
+
+            for (int j = 1, from = 0; from < numSamples; ++j, from += glideStep)
+            {
+                const float w = (float) j / (float) numSteps;
+
+                for (int i = 0; i < numTerms; ++i)
+                    c[i] = Vec::expand (current.t[i] + w * (target.t[i] - current.t[i]));
+
+                run<Dual> (c, s1, s2, f, f2, from, juce::jmin (numSamples, from + glideStep));
+            }
+        }
+        else
+        {
+            for (int i = 0; i < numTerms; ++i)
+                c[i] = Vec::expand (current.t[i]);
+
+            run<Dual> (c, s1, s2, f, f2, 0, numSamples);
+        }
+
+        ic1[g] = s1;
+        ic2[g] = s2;
+
+        // frames -> planar rows
+        for (int l = 0; l < numLanes; ++l)
+            for (int n = 0; n < numSamples; ++n)
+                out[l][n] = f[n * lanes + l];
+
+        if constexpr (Dual)
+            for (int l = 0; l < numLanes; ++l)
+                for (int n = 0; n < numSamples; ++n)
+                    out2[l][n] = f2[n * lanes + l];
+    }
+
+    double sr { 44100.0 };
+    int maxBlock { 1 };
+
+    juce::HeapBlock<float> frames;        // 2 x maxBlock x lanes, sample-major (one register per sample)
+    float* frameData { nullptr };         // frames from the first Vec-aligned float (HeapBlock is only malloc-aligned)
+    Vec ic1[maxGroups], ic2[maxGroups];   // integrator states, lane = channel
+
+    Coeffs current, target;
+    BlockCoeffs targetBlock;   // only used settled, i.e. current == target
+    float targetHz { 120.0f };
+    int   targetShape { highPass };
+    int   targetShape2 { -1 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricSvf)
+};
@@ -111,6 +111,22 @@ void GainReductionMeterComponent::setBallisticsMs (float attackMs, float release
     releaseCoeffMs = juce::jmax (0.1f, releaseMs);
 }
 
+void GainReductionMeterComponent::setTransferCurve (std::vector<float> outputDb, float minDb, float maxDb)
+{
+    curveOutDb = std::move (outputDb);
+    curveMinDb = minDb;
+    curveMaxDb = juce::jmax (minDb + 1.0f, maxDb);
+
+    if (showCurve)
+        repaint();
+}
+
+void GainReductionMeterComponent::mouseUp (const juce::MouseEvent&)
+{
+    showCurve = ! showCurve;
+    repaint();
+}
+
 void GainReductionMeterComponent::tick (double hz)
 {
     if (! useBallistics || hz <= 1.0)
@@ -537,6 +553,43 @@ void GainReductionMeterComponent::paint (juce::Graphics& g)
         }
     });
 
+    // =========================
+    // TRANSFER CURVE (inset, toggled by click)
+    // =========================
+    if (showCurve && curveOutDb.size() > 1)
+    {
+        const float side = plate.getHeight() * 0.42f;
+        auto box = Rectangle<float> (plate.getX() + S(10.0f), plate.getBottom() - side - S(10.0f), side, side);
+
+        g.setColour (Colour::fromRGBA (18, 12, 10, 40));
+        g.fillRoundedRectangle (box, S(3.0f));
+        g.setColour (GRPal::inkDim());
+        g.drawRoundedRectangle (box, S(3.0f), S(0.8f));
+
+        auto toPoint = [&] (float inDb, float outDb)
+        {
+            const float range = curveMaxDb - curveMinDb;
+            return Point<float> (box.getX() + box.getWidth() * (inDb - curveMinDb) / range,
+                                 box.getBottom() - box.getHeight() * jlimit (0.0f, 1.0f, (outDb - curveMinDb) / range));
+        };
+
+        // unity reference
+        g.setColour (GRPal::inkDim().withMultipliedAlpha (0.5f));
+        g.drawLine (Line<float> (toPoint (curveMinDb, curveMinDb), toPoint (curveMaxDb, curveMaxDb)), S(0.6f));
+
+        Path p;
+        const int num = (int) curveOutDb.size();
+        for (int i = 0; i < num; ++i)
+        {
+            const float inDb = curveMinDb + (curveMaxDb - curveMinDb) * (float) i / (float) (num - 1);
+            const auto pt = toPoint (inDb, curveOutDb[(size_t) i]);
+            if (i == 0) p.startNewSubPath (pt); else p.lineTo (pt);
+        }
+
+        g.setColour (GRPal::inkDark());
+        g.strokePath (p, PathStrokeType (S(1.4f), PathStrokeType::curved, PathStrokeType::rounded));
+    }
+
     // =========================
     // GLASS (very subtle)
     // =========================
@@ -22,6 +22,10 @@ public:
     void setMaxDb (float m) { maxDb = juce::jmax (1.0f, m); repaint(); }
     float getMaxDb() const  { return maxDb; }
 
+    // static curve inset (output dB at evenly spaced input dB, minDb..maxDb); click toggles it
+    void setTransferCurve (std::vector<float> outputDb, float minDb, float maxDb);
+    void mouseUp (const juce::MouseEvent&) override;
+
 private:
     // ballistics
     float currentDb = 0.0f;
@@ -36,5 +40,11 @@ private:
 
     juce::Image noise; // subtle screen texture
 
+    // transfer curve
+    std::vector<float> curveOutDb;
+    float curveMinDb = -60.0f;
+    float curveMaxDb = 0.0f;
+    bool  showCurve  = false;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GainReductionMeterComponent)
 };
@@ -13,9 +13,45 @@
 #include <memory>
 
 //==============================================================================
-// Custom Credits Overlay (no JUCE AlertWindow)
+// Custom overlays: credits / governor log, ADV settings (no JUCE AlertWindow)
 namespace
 {
+    // dark panel + gold title + rule; returns the area under the title
+    juce::Rectangle<float> drawOverlayPanel (juce::Graphics& g, juce::Rectangle<float> panel, const juce::String& title)
+    {
+        using namespace juce;
+
+        // Panel fill
+        {
+            ColourGradient cg (Colour::fromRGB (28, 28, 28), panel.getX(), panel.getY(),
+                               Colour::fromRGB (12, 12, 12), panel.getRight(), panel.getBottom(), false);
+            cg.addColour (0.35, Colour::fromRGB (20, 20, 20));
+            cg.addColour (0.72, Colour::fromRGB (14, 14, 14));
+            g.setGradientFill (cg);
+            g.fillRoundedRectangle (panel, 14.0f);
+        }
+
+        g.setColour (Colour::fromRGBA (255, 255, 255, 20));
+        g.drawRoundedRectangle (panel, 14.0f, 1.0f);
+
+        g.setColour (Colour::fromRGBA (0, 0, 0, 180));
+        g.drawRoundedRectangle (panel.reduced (0.8f), 13.0f, 1.8f);
+
+        auto inner = panel.reduced (20.0f);
+        auto titleArea = inner.removeFromTop (40.0f);
+
+        g.setColour (AuricTheme::goldText().withAlpha (0.92f));
+        g.setFont (AuricHelpers::makeFont (20.0f, Font::bold));
+        g.drawText (title, titleArea, Justification::centredLeft);
+
+        g.setColour (Colour::fromRGBA (255, 255, 255, 12));
+        g.drawLine (inner.getX(), titleArea.getBottom() + 6.0f,
+                    inner.getRight(), titleArea.getBottom() + 6.0f, 1.0f);
+
+        inner.removeFromTop (16.0f);
+        return inner;
+    }
+
     class CreditsOverlay : public juce::Component,
                            private juce::Button::Listener
     {
@@ -54,34 +90,7 @@ namespace
             panel.setCentre (b.getCentre());
             panel = panel.reduced (2.0f);
 
-            // Panel fill
-            {
-                ColourGradient cg (Colour::fromRGB (28, 28, 28), panel.getX(), panel.getY(),
-                                   Colour::fromRGB (12, 12, 12), panel.getRight(), panel.getBottom(), false);
-                cg.addColour (0.35, Colour::fromRGB (20, 20, 20));
-                cg.addColour (0.72, Colour::fromRGB (14, 14, 14));
-                g.setGradientFill (cg);
-                g.fillRoundedRectangle (panel, 14.0f);
-            }
-
-            g.setColour (Colour::fromRGBA (255, 255, 255, 20));
-            g.drawRoundedRectangle (panel, 14.0f, 1.0f);
-
-            g.setColour (Colour::fromRGBA (0, 0, 0, 180));
-            g.drawRoundedRectangle (panel.reduced (0.8f), 13.0f, 1.8f);
-
-            auto inner = panel.reduced (20.0f);
-            auto titleArea = inner.removeFromTop (40.0f);
-
-            g.setColour (AuricTheme::goldText().withAlpha (0.92f));
-            g.setFont (AuricHelpers::makeFont (20.0f, Font::bold));
-            g.drawText (titleText, titleArea, Justification::centredLeft);
-
-            g.setColour (Colour::fromRGBA (255, 255, 255, 12));
-            g.drawLine (inner.getX(), titleArea.getBottom() + 6.0f,
-                        inner.getRight(), titleArea.getBottom() + 6.0f, 1.0f);
-
-            inner.removeFromTop (16.0f);
+            auto inner = drawOverlayPanel (g, panel, titleText);
 
             g.setColour (Colour::fromRGBA (230, 230, 230, 210));
             g.setFont (AuricHelpers::makeFont (14.0f, Font::plain));
@@ -125,6 +134,183 @@ namespace
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CreditsOverlay)
     };
 
+    //==============================================================================
+    // ADV: detector / sidechain / drive AA parameters without a spot on the faceplate,
+    // same attachments as the main controls (automation + presets unchanged)
+    class AdvancedOverlay : public juce::Component
+    {
+    public:
+        explicit AdvancedOverlay (juce::AudioProcessorValueTreeState& state)
+            : apvts (state)
+        {
+            setInterceptsMouseClicks (true, true);
+
+            closeButton.setButtonText ("X");
+            closeButton.setWantsKeyboardFocus (false);
+            closeButton.setMouseCursor (juce::MouseCursor::PointingHandCursor);
+            closeButton.onClick = [this] { requestClose(); };
+            addAndMakeVisible (closeButton);
+
+            // left column: detector + stereo link
+            addChoice ("det_mode");
+            addSlider ("rms_window", " ms", 1);
+            addToggle ("det_eco");      // automatic above 96 kHz / governor L3 either way
+            addSlider ("lookahead", " ms", 1);
+            addChoice ("sc_mode");      // stereo only, mono / surround stay linked
+            addSlider ("sc_link", "", 2);
+
+            // right column: SC filter + band split + x1 drive AA
+            addChoice ("sc_shape");     // SC HPF on the faceplate switches it in
+            addSlider ("sc_freq", " Hz", 0);
+            addToggle ("multiband");
+            addSlider ("xover_lo", " Hz", 0);
+            addSlider ("xover_hi", " Hz", 0);
+            addChoice ("drive_aa");     // x1 only (O1, Auto at 176.4k+)
+        }
+
+        void paint (juce::Graphics& g) override
+        {
+            g.setColour (juce::Colour::fromRGBA (0, 0, 0, 150));
+            g.fillRect (getLocalBounds());
+
+            drawOverlayPanel (g, panel, "Advanced");
+
+            g.setColour (AuricTheme::goldText().withAlpha (0.80f));
+            g.setFont (AuricHelpers::makeFont (13.0f, juce::Font::plain));
+
+            for (const auto& r : rows)
+                g.drawText (r.label, r.labelArea, juce::Justification::centredLeft, true);
+        }
+
+        void resized() override
+        {
+            auto b = getLocalBounds().toFloat();
+
+            panel = juce::Rectangle<float> (0, 0, juce::jmin (600.0f, b.getWidth()  * 0.86f),
+                                                  juce::jmin (330.0f, b.getHeight() * 0.70f));
+            panel.setCentre (b.getCentre());
+            panel = panel.reduced (2.0f);
+
+            closeButton.setBounds (panel.toNearestInt().removeFromTop (34).removeFromRight (40).reduced (6));
+
+            // two columns, top-down, left column first
+            auto area = panel.reduced (20.0f).withTrimmedTop (62.0f).toNearestInt();
+            const int perColumn = juce::jmax (1, ((int) rows.size() + 1) / 2);
+            const int gap  = 24;
+            const int colW = (area.getWidth() - gap) / 2;
+            const int rowH = 34;
+
+            for (int i = 0; i < (int) rows.size(); ++i)
+            {
+                juce::Rectangle<int> r (area.getX() + (i / perColumn) * (colW + gap),
+                                        area.getY() + (i % perColumn) * rowH, colW, rowH - 8);
+
+                rows[(size_t) i].labelArea = r.removeFromLeft (100);
+
+                // on/off pills stay short, like GOV
+                auto* control = rows[(size_t) i].control;
+                control->setBounds (dynamic_cast<juce::Button*> (control) != nullptr ? r.withWidth (60) : r);
+            }
+        }
+
+        void mouseDown (const juce::MouseEvent& e) override
+        {
+            if (! panel.contains (e.position))
+                requestClose();
+        }
+
+        std::function<void()> onClose;
+
+    private:
+        using APVTS = juce::AudioProcessorValueTreeState;
+
+        struct Row
+        {
+            juce::String label;
+            juce::Component* control = nullptr;
+            juce::Rectangle<int> labelArea;
+        };
+
+        void addRow (const juce::String& paramId, juce::Component& control)
+        {
+            auto* param = apvts.getParameter (paramId);
+            jassert (param != nullptr);
+
+            rows.push_back ({ param != nullptr ? param->getName (32) : paramId, &control, {} });
+            addAndMakeVisible (control);
+        }
+
+        void addSlider (const juce::String& paramId, const juce::String& suffix, int decimals)
+        {
+            auto* s = sliders.add (new juce::Slider (juce::Slider::LinearHorizontal, juce::Slider::TextBoxRight));
+            s->setTextBoxStyle (juce::Slider::TextBoxRight, false, 70, 20);
+            s->setWantsKeyboardFocus (false);
+            s->setColour (juce::Slider::backgroundColourId,      AuricTheme::panelDark());
+            s->setColour (juce::Slider::trackColourId,           AuricTheme::goldTextDim());
+            s->setColour (juce::Slider::thumbColourId,           AuricTheme::goldTextHi());
+            s->setColour (juce::Slider::textBoxTextColourId,     AuricTheme::goldText());
+            s->setColour (juce::Slider::textBoxOutlineColourId,  juce::Colour (0x00000000));
+            s->setColour (juce::Slider::textBoxBackgroundColourId, AuricTheme::panelDark());
+
+            // set before the attachment, which only fills in what is missing
+            s->textFromValueFunction = [suffix, decimals] (double v) { return juce::String (v, decimals) + suffix; };
+            s->valueFromTextFunction = [] (const juce::String& t) { return t.getDoubleValue(); };
+
+            addRow (paramId, *s);
+            sliderAtts.add (new APVTS::SliderAttachment (apvts, paramId, *s));
+        }
+
+        // items = the parameter's choices, in order
+        void addChoice (const juce::String& paramId)
+        {
+            auto* box = boxes.add (new juce::ComboBox());
+            box->setJustificationType (juce::Justification::centredLeft);
+            box->setColour (juce::ComboBox::textColourId, AuricTheme::goldText().withAlpha (0.88f));
+            box->setColour (juce::ComboBox::backgroundColourId, juce::Colour (0x00000000));
+            box->setColour (juce::ComboBox::outlineColourId, juce::Colour (0x00000000));
+            box->setColour (juce::ComboBox::buttonColourId, juce::Colour (0x00000000));
+            box->setComponentID ("hdr_quality_box");
+
+            if (auto* choice = dynamic_cast<juce::AudioParameterChoice*> (apvts.getParameter (paramId)))
+                box->addItemList (choice->choices, 1);
+
+            addRow (paramId, *box);
+            boxAtts.add (new APVTS::ComboBoxAttachment (apvts, paramId, *box));
+        }
+
+        // header pill, lit while on
+        void addToggle (const juce::String& paramId)
+        {
+            auto* b = toggles.add (new juce::TextButton ("ON"));
+            b->setComponentID ("hdr_btn");
+            b->setClickingTogglesState (true);
+            b->setWantsKeyboardFocus (false);
+
+            addRow (paramId, *b);
+            toggleAtts.add (new APVTS::ButtonAttachment (apvts, paramId, *b));
+        }
+
+        void requestClose()
+        {
+            if (onClose) onClose();
+        }
+
+        APVTS& apvts;
+        juce::TextButton closeButton;
+        juce::Rectangle<float> panel;
+        std::vector<Row> rows;
+
+        // controls before attachments: attachments go first on destruction
+        juce::OwnedArray<juce::Slider> sliders;
+        juce::OwnedArray<juce::ComboBox> boxes;
+        juce::OwnedArray<juce::TextButton> toggles;
+        juce::OwnedArray<APVTS::SliderAttachment> sliderAtts;
+        juce::OwnedArray<APVTS::ComboBoxAttachment> boxAtts;
+        juce::OwnedArray<APVTS::ButtonAttachment> toggleAtts;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AdvancedOverlay)
+    };
+
     // IMPORTANT: keep meter pocket math in ONE place (so background + bounds always match)
     static inline juce::Rectangle<float> makeMeterPocketRect (const LayoutRects& lr)
     {
@@ -543,6 +729,18 @@ AuricOmega76AudioProcessorEditor::AuricOmega76AudioProcessorEditor (AuricOmega76
     qualityBox.setSelectedId (1, juce::dontSendNotification);
     addAndMakeVisible (qualityBox);
 
+    osPhaseBox.setJustificationType (juce::Justification::centredLeft);
+    osPhaseBox.setColour (juce::ComboBox::textColourId, AuricTheme::goldText().withAlpha (0.88f));
+    osPhaseBox.setColour (juce::ComboBox::backgroundColourId, juce::Colour (0x00000000));
+    osPhaseBox.setColour (juce::ComboBox::outlineColourId, juce::Colour (0x00000000));
+    osPhaseBox.setColour (juce::ComboBox::buttonColourId, juce::Colour (0x00000000));
+    osPhaseBox.setComponentID ("hdr_quality_box");
+
+    osPhaseBox.addItem ("MIN", 1);
+    osPhaseBox.addItem ("LIN", 2);
+    osPhaseBox.setSelectedId (1, juce::dontSendNotification);
+    addAndMakeVisible (osPhaseBox);
+
     addAndMakeVisible (presetSaveButton);
     addAndMakeVisible (presetLoadButton);
     addAndMakeVisible (presetDeleteButton);
@@ -708,6 +906,64 @@ AuricOmega76AudioProcessorEditor::AuricOmega76AudioProcessorEditor (AuricOmega76
         addChildComponent (*co);
     }
 
+    // CPU governor (header, right of the UI scale switch)
+    govButton.setComponentID ("hdr_btn");
+    govButton.setClickingTogglesState (true);
+    govButton.setWantsKeyboardFocus (false);
+    addAndMakeVisible (govButton);
+
+    govStatusButton.setComponentID ("hdr_btn");
+    govStatusButton.setWantsKeyboardFocus (false);
+    govStatusButton.onClick = [this] { showGovernorLog(); };
+    addAndMakeVisible (govStatusButton);
+
+    governorOverlay = std::make_unique<CreditsOverlay>();
+    if (auto* go = static_cast<CreditsOverlay*> (governorOverlay.get()))
+    {
+        go->setVisible (false);
+        go->setAlwaysOnTop (true);
+        go->onClose = [this]
+        {
+            if (governorOverlay)
+                governorOverlay->setVisible (false);
+            repaint();
+        };
+        addChildComponent (*go);
+    }
+
+    // ADV (header, left of Save): detector / sidechain / drive AA settings
+    advButton.setComponentID ("hdr_btn");
+    advButton.setWantsKeyboardFocus (false);
+    addAndMakeVisible (advButton);
+
+    {
+        auto ao = std::make_unique<AdvancedOverlay> (audioProcessor.apvts);
+        ao->setVisible (false);
+        ao->setAlwaysOnTop (true);
+        ao->onClose = [this]
+        {
+            if (advancedOverlay)
+                advancedOverlay->setVisible (false);
+            repaint();
+        };
+        addChildComponent (*ao);
+        advancedOverlay = std::move (ao);
+    }
+
+    advButton.onClick = [this]
+    {
+        if (! advancedOverlay) return;
+
+        const bool show = ! advancedOverlay->isVisible();
+        advancedOverlay->setBounds (getLocalBounds());
+        advancedOverlay->setVisible (show);
+
+        if (show)
+            advancedOverlay->toFront (true);
+
+        repaint();
+    };
+
     infoButton.onClick = [this]
     {
         if (! creditsOverlay) return;
@@ -748,10 +1004,12 @@ AuricOmega76AudioProcessorEditor::AuricOmega76AudioProcessorEditor (AuricOmega76
 
     scHpfAtt    = std::make_unique<APVTS::ButtonAttachment> (apvts, "sc_hpf", scHpfButton);
     pwrAtt      = std::make_unique<APVTS::ButtonAttachment> (apvts, "pwr",    pwrButton);
+    govAtt      = std::make_unique<APVTS::ButtonAttachment> (apvts, "cpu_guard", govButton);
 
     omegaModeAtt = std::make_unique<SegmentedSwitchAttachment> (apvts, "omega_mode", omegaModeSwitch);
     routingAtt   = std::make_unique<SegmentedSwitchAttachment> (apvts, "routing",    routingSwitch);
     qualityAtt   = std::make_unique<APVTS::ComboBoxAttachment> (apvts, "quality", qualityBox);
+    osPhaseAtt   = std::make_unique<APVTS::ComboBoxAttachment> (apvts, "os_phase", osPhaseBox);
 
     // Resizable
     setResizable (true, true);
@@ -774,6 +1032,8 @@ AuricOmega76AudioProcessorEditor::~AuricOmega76AudioProcessorEditor()
     stopTimer();
     presetChooser.reset();
     creditsOverlay.reset();
+    governorOverlay.reset();
+    advancedOverlay.reset();
     setLookAndFeel (nullptr);
 }
 
@@ -784,6 +1044,104 @@ void AuricOmega76AudioProcessorEditor::timerCallback()
     const float gr = audioProcessor.getGainReductionDb();
     grMeter.setGainReductionDb (gr);
     grMeter.tick (60.0);
+
+    updateQualityAutoText();
+    updateTransferCurve();
+
+    // governor readout doesn't need 60 Hz
+    if (++govTimerDivider >= 15)
+    {
+        govTimerDivider = 0;
+        updateGovernorStatus();
+    }
+}
+
+void AuricOmega76AudioProcessorEditor::updateTransferCurve()
+{
+    // reads the table the DSP is using, no extra DSP work
+    const auto* table = audioProcessor.getGainCurve();
+    if (table == shownCurve)
+        return;
+
+    constexpr float minDb = -60.0f, maxDb = 0.0f;
+    constexpr int numPoints = 121;
+
+    std::vector<float> outDb ((size_t) numPoints);
+    for (int i = 0; i < numPoints; ++i)
+        outDb[(size_t) i] = table->outputDbAt (minDb + (maxDb - minDb) * (float) i / (float) (numPoints - 1));
+
+    grMeter.setTransferCurve (std::move (outDb), minDb, maxDb);
+    shownCurve = table;
+}
+
+void AuricOmega76AudioProcessorEditor::updateQualityAutoText()
+{
+    const int factor = audioProcessor.getOversamplingFactor();
+    if (factor == shownAutoFactor)
+        return;
+
+    shownAutoFactor = factor;
+    qualityBox.changeItemText (1, omegaChar() + " Auto (x" + juce::String (factor) + ")");
+
+    // refresh the label if Auto is the current choice
+    if (qualityBox.getSelectedId() == 1)
+        qualityBox.setSelectedId (1, juce::dontSendNotification);
+}
+
+void AuricOmega76AudioProcessorEditor::updateGovernorStatus()
+{
+    const auto& gov = audioProcessor.getCpuGovernor();
+    const int level = gov.getLevel();
+    const int loadPct = juce::roundToInt (juce::jlimit (0.0f, 9.99f, gov.getLoad()) * 100.0f);
+
+    if (level == govShownLevel && loadPct == govShownLoadPct)
+        return;
+
+    govShownLevel = level;
+    govShownLoadPct = loadPct;
+    govStatusButton.setButtonText ("CPU " + juce::String (loadPct) + "% L" + juce::String (level));
+
+    if (governorOverlay != nullptr && governorOverlay->isVisible())
+        showGovernorLog();
+}
+
+void AuricOmega76AudioProcessorEditor::showGovernorLog()
+{
+    auto* go = static_cast<CreditsOverlay*> (governorOverlay.get());
+    if (go == nullptr)
+        return;
+
+    const auto& gov = audioProcessor.getCpuGovernor();
+
+    std::vector<AuricCpuGovernor::Event> events;
+    gov.getEvents (events);
+
+    juce::String body;
+    body << "Now: " << AuricOmega76AudioProcessor::describeGovernorLevel (gov.getLevel())
+         << "  |  load " << juce::String (gov.getLoad() * 100.0f, 0) << "% of deadline\n";
+    body << "Steps logged: " << gov.getNumEventsLogged() << "\n";
+
+    // newest first, as many as fit
+    const int maxLines = 6;
+    for (int i = (int) events.size() - 1, shown = 0; i >= 0 && shown < maxLines; --i, ++shown)
+    {
+        const auto& e = events[(size_t) i];
+        body << juce::Time (e.timeMs).formatted ("%H:%M:%S") << "  L" << e.fromLevel << " -> L" << e.toLevel
+             << "  " << AuricCpuGovernor::reasonToString (e.reason)
+             << " (" << juce::String (e.load * 100.0f, 0) << "%)\n";
+    }
+
+    if (events.empty())
+        body << "No quality changes yet.";
+
+    go->setText ("CPU Governor", body);
+
+    if (! go->isVisible())
+    {
+        go->setBounds (getLocalBounds());
+        go->setVisible (true);
+        go->toFront (true);
+    }
 }
 
 //==============================================================================
@@ -816,12 +1174,16 @@ void AuricOmega76AudioProcessorEditor::resized()
     presetLabel.setBounds (toInt (lr.presetLabel));
     presetBox.setBounds (toInt (lr.presetBox));
     qualityBox.setBounds (toInt (lr.qualityBox));
+    osPhaseBox.setBounds (toInt (lr.osPhaseBox));
 
     presetSaveButton.setBounds (toInt (lr.presetSaveButton));
     presetLoadButton.setBounds (toInt (lr.presetLoadButton));
     presetDeleteButton.setBounds (toInt (lr.presetDeleteButton));
+    advButton.setBounds (toInt (lr.advButton));
     infoButton.setBounds (toInt (lr.infoButton));
     uiScaleSwitch.setBounds (toInt (lr.uiScaleSwitch));
+    govButton.setBounds (toInt (lr.govButton));
+    govStatusButton.setBounds (toInt (lr.govStatusButton));
 
     // Main row
     inputKnob.setBounds (toInt (lr.inputKnob));
@@ -878,5 +1240,11 @@ void AuricOmega76AudioProcessorEditor::resized()
     if (creditsOverlay)
         creditsOverlay->setBounds (getLocalBounds());
 
+    if (governorOverlay)
+        governorOverlay->setBounds (getLocalBounds());
+
+    if (advancedOverlay)
+        advancedOverlay->setBounds (getLocalBounds());
+
     bgDirty = true;
 }
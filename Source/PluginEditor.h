@@ -168,12 +168,16 @@ struct LayoutRects
     juce::Rectangle<float> presetLabel;
     juce::Rectangle<float> presetBox;
     juce::Rectangle<float> qualityBox;
+    juce::Rectangle<float> osPhaseBox;
 
+    juce::Rectangle<float> advButton;
     juce::Rectangle<float> presetSaveButton;
     juce::Rectangle<float> presetLoadButton;
     juce::Rectangle<float> presetDeleteButton;
     juce::Rectangle<float> infoButton;
     juce::Rectangle<float> uiScaleSwitch;
+    juce::Rectangle<float> govButton;
+    juce::Rectangle<float> govStatusButton;
 
     float separatorY = 0.0f; // header separator
 
@@ -226,14 +230,18 @@ static LayoutRects make (juce::Rectangle<float> outerBounds)
     lr.brand       = { ui.getX() + 28*S,  ui.getY() + 20*S, 160*S, 32*S };
     lr.presetLabel = { ui.getX() + 285*S, ui.getY() + 22*S,  80*S, 22*S };
     lr.presetBox   = { ui.getX() + 365*S, ui.getY() + 16*S, 300*S, 28*S };
-    lr.qualityBox  = { ui.getX() + 690*S, ui.getY() + 16*S, 290*S, 28*S };
+    lr.qualityBox  = { ui.getX() + 690*S, ui.getY() + 16*S, 200*S, 28*S };
+    lr.osPhaseBox  = { ui.getX() + 895*S, ui.getY() + 16*S,  85*S, 28*S };
 
     const float btnY = ui.getY() + 52*S;
+    lr.advButton          = { ui.getX() + 405*S, btnY, 50*S, 20*S };
     lr.presetSaveButton   = { ui.getX() + 460*S, btnY, 50*S, 20*S };
     lr.presetLoadButton   = { ui.getX() + 515*S, btnY, 50*S, 20*S };
     lr.presetDeleteButton = { ui.getX() + 570*S, btnY, 50*S, 20*S };
     lr.infoButton         = { ui.getX() + 630*S, btnY, 24*S, 20*S };
     lr.uiScaleSwitch      = { ui.getX() + 665*S, btnY, 110*S, 20*S };
+    lr.govButton          = { ui.getX() + 790*S, btnY,  50*S, 20*S };
+    lr.govStatusButton    = { ui.getX() + 845*S, btnY, 135*S, 20*S };
 
     lr.separatorY = ui.getY() + 90*S;
 
@@ -404,6 +412,16 @@ private:
     void showHelpText (const juce::String& text);
     void clearHelpText();
 
+    // "Ω Auto" item shows the factor the processor picked
+    void updateQualityAutoText();
+
+    // static curve inset on the GR meter (click the meter)
+    void updateTransferCurve();
+
+    // CPU governor readout + step log overlay
+    void updateGovernorStatus();
+    void showGovernorLog();
+
     // Background (CACHED)
     void rebuildNoiseTile();
     void rebuildBackground();
@@ -413,6 +431,8 @@ private:
     AuricLookAndFeel auricLnf;
     PresetManager presetManager;
     std::unique_ptr<juce::Component> creditsOverlay;
+    std::unique_ptr<juce::Component> governorOverlay;
+    std::unique_ptr<juce::Component> advancedOverlay;   // ADV: detector / sidechain settings
 
     // UI scale state
     int uiScaleIndex = 1; // 0=S, 1=M, 2=L
@@ -426,6 +446,19 @@ private:
     // Header - info button
     juce::TextButton infoButton { "i" };
 
+    // Header - advanced settings
+    juce::TextButton advButton { "ADV" };
+
+    // Header - CPU governor
+    juce::TextButton govButton { "GOV" };
+    juce::TextButton govStatusButton { "CPU --" };
+    int govShownLevel = -1;
+    int govShownLoadPct = -1;
+    int govTimerDivider = 0;
+
+    // gain-curve table shown on the meter
+    const AuricGainCurve::Table* shownCurve = nullptr;
+
     // Labels
     juce::Label titleLabel, presetLabel;
     juce::Label inputLabel, releaseLabel, edgeLabel, modeLabel, mixLabel, omegaMixLabel;
@@ -434,6 +467,8 @@ private:
     // Preset UI
     juce::ComboBox presetBox;
     juce::ComboBox qualityBox;
+    juce::ComboBox osPhaseBox;
+    int shownAutoFactor = 0;
     juce::TextButton presetSaveButton { "Save" };
     juce::TextButton presetLoadButton { "Load" };
     juce::TextButton presetDeleteButton { "Del" };
@@ -465,9 +500,9 @@ private:
 
     // Attachments
     std::unique_ptr<APVTS::SliderAttachment> inputAtt, releaseAtt, edgeAtt, modeAtt, mixAtt, omegaMixAtt;
-    std::unique_ptr<APVTS::ButtonAttachment> scHpfAtt, pwrAtt;
+    std::unique_ptr<APVTS::ButtonAttachment> scHpfAtt, pwrAtt, govAtt;
     std::unique_ptr<SegmentedSwitchAttachment> omegaModeAtt, routingAtt;
-    std::unique_ptr<APVTS::ComboBoxAttachment> qualityAtt;
+    std::unique_ptr<APVTS::ComboBoxAttachment> qualityAtt, osPhaseAtt;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricOmega76AudioProcessorEditor)
 };
@@ -1,6 +1,23 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // times the whole processBlock, early returns included
+    struct ScopedGovernorTimer
+    {
+        ScopedGovernorTimer (AuricCpuGovernor& g, int n, bool enabled) noexcept
+            : gov (g), numSamples (n), isEnabled (enabled), start (AuricCpuGovernor::beginBlock()) {}
+
+        ~ScopedGovernorTimer() { gov.endBlock (start, numSamples, isEnabled); }
+
+        AuricCpuGovernor& gov;
+        int numSamples;
+        bool isEnabled;
+        juce::int64 start;
+    };
+}
+
 //==============================================================================
 AuricOmega76AudioProcessor::AuricOmega76AudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -8,6 +25,7 @@ AuricOmega76AudioProcessor::AuricOmega76AudioProcessor()
                      #if ! JucePlugin_IsMidiEffect
                       #if ! JucePlugin_IsSynth
                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)   // external key
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
@@ -15,9 +33,13 @@ AuricOmega76AudioProcessor::AuricOmega76AudioProcessor()
        apvts (*this, nullptr, "PARAMS", createParameterLayout())
 #endif
 {
+    paramTable.resolve (apvts);
 }
 
-AuricOmega76AudioProcessor::~AuricOmega76AudioProcessor() {}
+AuricOmega76AudioProcessor::~AuricOmega76AudioProcessor()
+{
+    cancelPendingUpdate();
+}
 
 //==============================================================================
 const juce::String AuricOmega76AudioProcessor::getName() const { return JucePlugin_Name; }
@@ -58,17 +80,31 @@ const juce::String AuricOmega76AudioProcessor::getProgramName (int) { return {};
 void AuricOmega76AudioProcessor::changeProgramName (int, const juce::String&) {}
 
 //==============================================================================
-void AuricOmega76AudioProcessor::prepareToPlay (double sampleRate, int /*samplesPerBlock*/)
+void AuricOmega76AudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
     sr = sampleRate;
 
-    env = 0.0f;
-    gainLin = 1.0f;
     grDb.store (0.0f);
 
-    scHpfL.reset();
-    scHpfR.reset();
-    updateSidechainHPF();
+    const auto p = paramTable.read();
+    derivedValid = false;
+
+    // engine runs fixed internal sub-blocks; host block size only matters to JUCE
+    juce::ignoreUnused (samplesPerBlock);
+    engine.prepare (sr, juce::jmax (1, getMainBusNumInputChannels()));
+    gainCurve.store (&AuricGainCurve::forMode (p.omegaMode));
+
+    governor.setMaxLevel (governorMaxLevel);
+    governor.prepare (sr);
+
+    const int latency = engine.getLatencySamplesFor (getReportedFactorLog2 (p.quality),
+                                                     p.osPhase,
+                                                     getAdaaOrder (p.quality, p.driveAa),
+                                                     getLookaheadSamples (p.lookaheadMs));
+    pendingLatency.store (latency);
+    setLatencySamples (latency);
+
+    activeOsFactor.store (1 << getOversamplingFactorLog2 (p.quality));
 }
 
 void AuricOmega76AudioProcessor::releaseResources() {}
@@ -76,13 +112,27 @@ void AuricOmega76AudioProcessor::releaseResources() {}
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool AuricOmega76AudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
 {
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono())
+    // any layout up to 16 channels (mono, stereo, 5.1, 7.1, 7.1.4, 9.1.6, discrete ...)
+    const auto out = layouts.getMainOutputChannelSet();
+
+    if (out.isDisabled() || out.size() > AuricCompressorEngine::maxChannels)
         return false;
 
    #if ! JucePlugin_IsSynth
-    if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
+    // in == out, plus mono -> stereo (mono kernel, L copied out)
+    const auto in = layouts.getMainInputChannelSet();
+
+    if (in != out && ! (in == juce::AudioChannelSet::mono() && out == juce::AudioChannelSet::stereo()))
         return false;
+
+    // sidechain: off, mono or stereo (whatever the main bus is)
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto key = layouts.getChannelSet (true, 1);
+
+        if (! key.isDisabled() && key != juce::AudioChannelSet::mono() && key != juce::AudioChannelSet::stereo())
+            return false;
+    }
    #endif
 
     return true;
@@ -90,184 +140,215 @@ bool AuricOmega76AudioProcessor::isBusesLayoutSupported (const BusesLayout& layo
 #endif
 
 //==============================================================================
-float AuricOmega76AudioProcessor::getParam (const juce::String& id, float fallback) const noexcept
+int AuricOmega76AudioProcessor::getOversamplingFactorLog2 (int qualityIndex) const noexcept
 {
-    if (auto* p = apvts.getRawParameterValue (id))
-        return p->load();
-    return fallback;
+    // 0 Ω Auto, 1 O1 x1, 2 O3 x2, 3 O3 x4
+    switch (qualityIndex)
+    {
+        case 1:  return 0;
+        case 2:  return 1;
+        case 3:  return 2;
+        default: break;
+    }
+
+    // Ω Auto: bounces always get the best, live tracking scales with sample rate
+    if (isNonRealtime())  return 2;
+    if (sr < 80000.0)     return 2;   // 44.1 / 48k   -> x4
+    if (sr < 160000.0)    return 1;   // 88.2 / 96k   -> x2
+    return 0;                         // 176.4k and up -> x1
 }
 
-int AuricOmega76AudioProcessor::getChoice (const juce::String& id, int fallback) const noexcept
+int AuricOmega76AudioProcessor::getReportedFactorLog2 (int qualityIndex) const noexcept
 {
-    if (auto* p = apvts.getRawParameterValue (id))
-        return (int) juce::jlimit (0.0f, 1000.0f, p->load());
-    return fallback;
+    // Auto's largest factor (offline, or 44.1 / 48k live)
+    return qualityIndex == 0 ? 2 : getOversamplingFactorLog2 (qualityIndex);
 }
 
-bool AuricOmega76AudioProcessor::getBool (const juce::String& id, bool fallback) const noexcept
+int AuricOmega76AudioProcessor::getAdaaOrder (int qualityIndex, int driveAaIndex) const noexcept
 {
-    if (auto* p = apvts.getRawParameterValue (id))
-        return p->load() >= 0.5f;
-    return fallback;
+    // drive_aa only counts at x1 (O1, or Auto live at 176.4k and up); oversampled tiers ignore it
+    return getOversamplingFactorLog2 (qualityIndex) == 0 ? juce::jlimit (0, 2, driveAaIndex) : 0;
 }
 
-void AuricOmega76AudioProcessor::updateSidechainHPF()
+int AuricOmega76AudioProcessor::getLookaheadSamples (float ms) const noexcept
 {
-    // SC HPF around 120 Hz (detector only)
-    const double fc = 120.0;
-    scHpfCoeffs = juce::IIRCoefficients::makeHighPass (sr, fc);
+    return juce::roundToInt (ms * 0.001 * sr);
+}
 
-    scHpfL.setCoefficients (scHpfCoeffs);
-    scHpfR.setCoefficients (scHpfCoeffs);
+juce::String AuricOmega76AudioProcessor::describeGovernorLevel (int level)
+{
+    switch (level)
+    {
+        case 0:  return "L0 full quality";
+        case 1:  return "L1 oversampling/ADAA -1 step";
+        case 2:  return "L2 oversampling/ADAA off";
+        case 3:  return "L3 oversampling/ADAA off, eco drive + detector";
+        default: return "L" + juce::String (level);
+    }
 }
 
-//==============================================================================
-void AuricOmega76AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+void AuricOmega76AudioProcessor::updateDerivedSettings (const AuricParams::Snapshot& p) noexcept
 {
-    juce::ignoreUnused (midiMessages);
+    // prepareToPlay clears derivedValid (sample rate may have moved)
+    const bool all = ! derivedValid;
+    const auto& last = derivedFrom;
 
-    const auto totalNumInputChannels  = getTotalNumInputChannels();
-    const auto totalNumOutputChannels = getTotalNumOutputChannels();
+    // one-pole leak = 1 - exp (-1 / (t * sr)); expm1 keeps it exact near 0
+    if (all)
+    {
+        const double atkMs = 10.0;
+        settings.atkLeak = (float) -std::expm1 (-1.0 / (0.001 * atkMs * sr));
+    }
 
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
+    if (all || p.releaseMs != last.releaseMs)
+        settings.relLeak = (float) -std::expm1 (-1.0 / (0.001 * (double) p.releaseMs * sr));
 
-    // parameters
-    const bool pwr   = getBool ("pwr", true);
-    const bool scHpf = getBool ("sc_hpf", false);
+    if (all || p.inputDb != last.inputDb)
+        settings.inGain = dbToLin (p.inputDb);
 
-    const float inputDb = getParam ("input", 0.0f);
-    const float relMs   = getParam ("release", 150.0f);
-    const float edge    = getParam ("edge", 0.0f);   // 0..1
-    const float mode    = getParam ("mode", 0.5f);   // 0..1
-    const float mix     = getParam ("mix",  1.0f);   // 0..1
-    const float omegaMix= getParam ("omega_mix", 1.0f); // 0..1
+    // drive berdasarkan mode knob (continuous); omegaMode boost ada di AuricSaturator::Voicing
+    if (all || p.mode != last.mode)
+        settings.driveBase = juce::jmap (p.mode, 0.0f, 1.0f, 1.0f, 12.0f);
 
-    const int omegaMode = getChoice ("omega_mode", 0);   // 0 clean,1 iron,2 grit
-    const int routing   = getChoice ("routing", 0);      // 0 A,1 D,2 Ω
+    if (all || p.edge != last.edge)
+        settings.hard = juce::jmap (p.edge, 0.0f, 1.0f, 1.0f, 2.6f);
 
-    if (! pwr)
-    {
-        grDb.store (0.0f);
-        return; // hard bypass
-    }
+    if (all || p.rmsWindowMs != last.rmsWindowMs)
+        settings.rmsWindow = juce::jmax (1, juce::roundToInt (0.001 * (double) p.rmsWindowMs * sr));
 
-    // compressor tuning
-    const float thresholdDb = -18.0f;
+    derivedFrom  = p;
+    derivedValid = true;
+}
 
-    // ratio berdasarkan omegaMode switch (discrete)
-    float ratio = 2.0f;
-    if (omegaMode == 1) ratio = 4.0f;
-    if (omegaMode == 2) ratio = 8.0f;
+void AuricOmega76AudioProcessor::handleAsyncUpdate()
+{
+    const int latency = pendingLatency.load();
+    if (latency != getLatencySamples())
+        setLatencySamples (latency);
+}
 
-    const float atkMs = 10.0f;
-    const float atkCoeff = std::exp (-1.0f / (float) (0.001 * atkMs * sr));
-    const float relCoeff = std::exp (-1.0f / (float) (0.001 * relMs * sr));
+//==============================================================================
+void AuricOmega76AudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processSamples (buffer);
+}
 
-    // drive berdasarkan mode knob (continuous) + omegaMode boost
-    const float driveBase = juce::jmap (mode, 0.0f, 1.0f, 1.0f, 12.0f);
-    const float driveModeBoost = (omegaMode == 0 ? 1.0f : (omegaMode == 1 ? 1.35f : 1.8f));
-    const float drive = driveBase * driveModeBoost;
+// 64-bit hosts hand us their buffers directly (no float copy in the wrapper)
+void AuricOmega76AudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processSamples (buffer);
+}
 
-    const float hard = juce::jmap (edge, 0.0f, 1.0f, 1.0f, 2.6f);
+template <typename SampleType>
+void AuricOmega76AudioProcessor::processSamples (juce::AudioBuffer<SampleType>& buffer)
+{
+    // decaying envelopes / filter states must not drop into denormals (FTZ/DAZ for this block)
+    juce::ScopedNoDenormals noDenormals;
+
+    // main bus only; the sidechain channels sit behind it in the same buffer
+    // (and may share indices with extra outputs, so those are filled afterwards)
+    const int numMainIn  = getMainBusNumInputChannels();
+    const int numMainOut = getMainBusNumOutputChannels();
+
+    // parameters: one snapshot per block
+    const auto p = paramTable.read();
+
+    // offline renders have no deadline -> governor stays at full quality
+    ScopedGovernorTimer governorTimer (governor, buffer.getNumSamples(), p.cpuGuard && ! isNonRealtime());
+
+    // only the input channels go through the engine: a mono input runs the mono
+    // kernel (no phantom right channel), mono -> stereo gets L copied out afterwards
+    auto* const* channels = buffer.getArrayOfWritePointers();
+    const int numChannels = juce::jmin (numMainIn, buffer.getNumChannels());
+
+    // governor trims oversampling (and Auto runs x2 / x1 live) but the host keeps seeing the reported latency
+    // (ADAA steps down the same way: 2 -> 1 -> off)
+    const int requestedOsLog2 = getOversamplingFactorLog2 (p.quality);
+    const int requestedAdaa   = getAdaaOrder (p.quality, p.driveAa);
+    const int osFactorLog2    = juce::jmax (0, requestedOsLog2 - governor.getLevel());
+    const int adaaOrder       = juce::jmax (0, requestedAdaa - governor.getLevel());
+    const int lookahead       = getLookaheadSamples (p.lookaheadMs);
+    const int latencyFloor    = engine.getLatencySamplesFor (getReportedFactorLog2 (p.quality), p.osPhase, requestedAdaa, lookahead);
+
+    if (! p.pwr)
+    {
+        grDb.store (0.0f);
+        engine.processBypassed (channels, numChannels, buffer.getNumSamples(), osFactorLog2, p.osPhase, adaaOrder, lookahead, latencyFloor); // hard bypass, latency kept
+        fillExtraOutputs (buffer, numChannels, numMainOut);
 
-    const float inGain = dbToLin (inputDb);
+        publishOversamplingState();
+        return;
+    }
 
-    auto numSamples = buffer.getNumSamples();
-    auto* L = buffer.getWritePointer (0);
-    auto* R = buffer.getNumChannels() > 1 ? buffer.getWritePointer (1) : nullptr;
+    updateDerivedSettings (p);
+    auto& s = settings;
+
+    // compressor curve: tabel per omegaMode sudah jadi (shared), tinggal pilih
+    s.curve = &AuricGainCurve::forMode (p.omegaMode);
+    gainCurve.store (s.curve, std::memory_order_release);
+
+    s.omegaMode = p.omegaMode;
+    s.satEco    = governor.getLevel() >= 3;
+
+    s.mix      = p.mix;
+    s.omegaMix = p.omegaMix;
+    s.routing  = p.routing;
+    s.scHpf    = p.scHpf;
+    s.scShape  = p.scShape;
+    s.scFreq   = p.scFreq;
+    s.multiband = p.multiband;
+    s.xoverLow  = p.xoverLow;
+    s.xoverHigh = p.xoverHigh;
+    s.scMode   = p.scMode;
+    s.scLink   = p.scLink;
+    s.detMode  = p.detMode;
+    s.detEco   = p.detEco || governor.getLevel() >= 3;
+
+    s.osFactorLog2 = osFactorLog2;
+    s.osPhase      = p.osPhase;
+    s.adaaOrder    = adaaOrder;
+    s.lookahead    = lookahead;
+    s.latencyFloor = latencyFloor;
+
+    // external key straight from the host buffer (enabled sidechain bus only)
+    const int numKey = getBusCount (true) > 1 ? getChannelCountOfBus (true, 1) : 0;
+    const SampleType* const* key = numKey > 0 ? buffer.getArrayOfReadPointers() + getChannelIndexInProcessBlockBuffer (true, 1, 0)
+                                              : nullptr;
+
+    const float grDbLocal = engine.process (channels, numChannels, buffer.getNumSamples(), s, key, numKey);
+    fillExtraOutputs (buffer, numChannels, numMainOut);
 
-    float grDbLocal = 0.0f;
+    grDb.store (juce::jlimit (0.0f, 30.0f, grDbLocal));
 
-    for (int n = 0; n < numSamples; ++n)
+    publishOversamplingState();
+}
+
+template <typename SampleType>
+void AuricOmega76AudioProcessor::fillExtraOutputs (juce::AudioBuffer<SampleType>& buffer, int numProcessed, int numOutputs)
+{
+    // mono -> stereo: processed L on both sides; anything else past the input is silence
+    for (int ch = numProcessed; ch < juce::jmin (numOutputs, buffer.getNumChannels()); ++ch)
     {
-        float xL = L[n] * inGain;
-        float xR = (R != nullptr ? R[n] * inGain : xL);
-
-        // detector source
-        float dL = xL;
-        float dR = xR;
-
-        if (scHpf)
-        {
-            dL = scHpfL.processSingleSampleRaw (dL);
-            dR = scHpfR.processSingleSampleRaw (dR);
-        }
-
-        const float detector = 0.5f * (std::abs (dL) + std::abs (dR));
-
-        // envelope follower
-        const float coeff = (detector > env ? atkCoeff : relCoeff);
-        env = detector + coeff * (env - detector);
-
-        // compute GR
-        const float envDb = linToDb (env + 1.0e-8f);
-
-        float targetGainDb = 0.0f;
-        if (envDb > thresholdDb)
-        {
-            const float over = envDb - thresholdDb;
-            const float compressedOver = over / ratio;
-            targetGainDb = (thresholdDb + compressedOver) - envDb; // negative
-        }
-
-        const float targetGainLin = dbToLin (targetGainDb);
-
-        // smooth gain
-        const float gCoeff = (targetGainLin < gainLin ? atkCoeff : relCoeff);
-        gainLin = targetGainLin + gCoeff * (gainLin - targetGainLin);
-
-        // blocks
-        auto doComp = [&] (float& a, float& b)
-        {
-            a *= gainLin;
-            b *= gainLin;
-        };
-
-        auto doDrive = [&] (float& a, float& b)
-        {
-            auto sat = [drive, hard] (float v)
-            {
-                float y = v * drive;
-                y = std::atan (y * hard) / std::atan (hard); // stable
-                return y;
-            };
-
-            a = sat (a);
-            b = sat (b);
-        };
-
-        float wetL = xL;
-        float wetR = xR;
-
-        if (routing == 0)            // A = comp
-        {
-            doComp (wetL, wetR);
-        }
-        else if (routing == 1)       // D = drive
-        {
-            doDrive (wetL, wetR);
-        }
-        else                         // Ω = comp -> drive (+ omegaMix)
-        {
-            doComp (wetL, wetR);
-            doDrive (wetL, wetR);
-            wetL = juce::jmap (omegaMix, xL, wetL);
-            wetR = juce::jmap (omegaMix, xR, wetR);
-        }
-
-        // wet/dry
-        const float outL = juce::jmap (mix, xL, wetL);
-        const float outR = juce::jmap (mix, xR, wetR);
-
-        L[n] = outL;
-        if (R != nullptr) R[n] = outR;
-
-        const float grPosDb = -linToDb (gainLin);
-        if (grPosDb > grDbLocal) grDbLocal = grPosDb;
+        if (numProcessed == 1 && ch == 1)
+            buffer.copyFrom (1, 0, buffer, 0, 0, buffer.getNumSamples());
+        else
+            buffer.clear (ch, 0, buffer.getNumSamples());
     }
+}
 
-    grDb.store (juce::jlimit (0.0f, 30.0f, grDbLocal));
+void AuricOmega76AudioProcessor::publishOversamplingState() noexcept
+{
+    activeOsFactor.store (engine.getOversamplingFactor());
+
+    // mode swaps happen inside the engine's fade; host hears about it right after
+    const int latency = engine.getLatencySamples();
+    if (latency != pendingLatency.load())
+    {
+        pendingLatency.store (latency);
+        triggerAsyncUpdate();
+    }
 }
 
 //==============================================================================
@@ -306,59 +387,136 @@ AuricOmega76AudioProcessor::APVTS::ParameterLayout AuricOmega76AudioProcessor::c
     std::vector<std::unique_ptr<RangedAudioParameter>> params;
 
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "input", 1 }, "INPUT",
+        AuricParams::parameterId (AuricParams::input), "INPUT",
         NormalisableRange<float> (-60.0f, 10.0f, 0.01f),
         0.0f));
 
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "release", 1 }, "RELEASE",
+        AuricParams::parameterId (AuricParams::release), "RELEASE",
         NormalisableRange<float> (10.0f, 1000.0f, 0.01f, 0.5f),
         150.0f));
 
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "edge", 1 }, "EDGE",
+        AuricParams::parameterId (AuricParams::edge), "EDGE",
         NormalisableRange<float> (0.0f, 1.0f, 0.001f),
         0.0f));
 
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "mode", 1 }, "MODE",
+        AuricParams::parameterId (AuricParams::mode), "MODE",
         NormalisableRange<float> (0.0f, 1.0f, 0.001f),
         0.5f));
 
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "mix", 1 }, "MIX",
+        AuricParams::parameterId (AuricParams::mix), "MIX",
         NormalisableRange<float> (0.0f, 1.0f, 0.001f),
         1.0f));
 
     // supaya knob Ω MIX di UI match & gak perlu comment attachment
     params.push_back (std::make_unique<AudioParameterFloat> (
-        ParameterID { "omega_mix", 1 }, "Ω MIX",
+        AuricParams::parameterId (AuricParams::omegaMix), "Ω MIX",
         NormalisableRange<float> (0.0f, 1.0f, 0.001f),
         1.0f));
 
     params.push_back (std::make_unique<AudioParameterBool> (
-        ParameterID { "sc_hpf", 1 }, "SC HPF",
+        AuricParams::parameterId (AuricParams::scHpf), "SC HPF",
         false));
 
     params.push_back (std::make_unique<AudioParameterBool> (
-        ParameterID { "pwr", 1 }, "PWR",
+        AuricParams::parameterId (AuricParams::pwr), "PWR",
         true));
 
     params.push_back (std::make_unique<AudioParameterChoice> (
-        ParameterID { "omega_mode", 1 }, "Ω MODE",
+        AuricParams::parameterId (AuricParams::omegaMode), "Ω MODE",
         StringArray { "CLEAN", "IRON", "GRIT" },
         0));
 
     params.push_back (std::make_unique<AudioParameterChoice> (
-        ParameterID { "routing", 1 }, "ROUTING",
+        AuricParams::parameterId (AuricParams::routing), "ROUTING",
         StringArray { "A", "D", "Ω" },
         0));
 
     params.push_back (std::make_unique<AudioParameterChoice> (
-        ParameterID { "quality", 1 }, "QUALITY",
+        AuricParams::parameterId (AuricParams::quality), "QUALITY",
         StringArray { "Ω Auto", "O1 x1", "O3 x2", "O3 x4" },
         0));
 
+    // half-band filter flavour for oversampling (MIN = low latency, LIN = no phase shift)
+    params.push_back (std::make_unique<AudioParameterChoice> (
+        AuricParams::parameterId (AuricParams::osPhase), "OS PHASE",
+        StringArray { "MIN", "LIN" },
+        0));
+
+    // live rigs: let the CPU governor trade quality for xrun safety
+    params.push_back (std::make_unique<AudioParameterBool> (
+        AuricParams::parameterId (AuricParams::cpuGuard), "CPU GUARD",
+        false));
+
+    // stereo detection: linked, unlinked L/R or M/S (mono / surround stay linked)
+    params.push_back (std::make_unique<AudioParameterChoice> (
+        AuricParams::parameterId (AuricParams::scMode), "SC MODE",
+        StringArray { "L+R", "L/R", "M/S" },
+        0));
+
+    // L/R, M/S: how far each side's detector is pulled towards the linked level
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::scLink), "SC LINK",
+        NormalisableRange<float> (0.0f, 1.0f, 0.001f),
+        0.0f));
+
+    // delays the audio, not the detector: gain reduction is already down when the peak arrives
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::lookahead), "LOOKAHEAD",
+        NormalisableRange<float> (0.0f, 10.0f, 0.1f),
+        0.0f));
+
+    // detector: peak, windowed RMS, or the average of both
+    params.push_back (std::make_unique<AudioParameterChoice> (
+        AuricParams::parameterId (AuricParams::detMode), "DETECTOR",
+        StringArray { "PEAK", "RMS", "P+R" },
+        0));
+
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::rmsWindow), "RMS WINDOW",
+        NormalisableRange<float> (1.0f, 100.0f, 0.1f, 0.5f),
+        10.0f));
+
+    // SC HPF switch turns the detector EQ on; shape + frequency (glides, no zipper)
+    params.push_back (std::make_unique<AudioParameterChoice> (
+        AuricParams::parameterId (AuricParams::scShape), "SC SHAPE",
+        StringArray { "HPF", "BPF", "TILT" },
+        0));
+
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::scFreq), "SC FREQ",
+        NormalisableRange<float> (20.0f, 5000.0f, 0.1f, 0.3f),
+        120.0f));
+
+    // 3-band split (LR4): each band its own detector / envelope / gain, same curve
+    params.push_back (std::make_unique<AudioParameterBool> (
+        AuricParams::parameterId (AuricParams::multiband), "MULTIBAND",
+        false));
+
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::xoverLow), "XOVER LO",
+        NormalisableRange<float> (40.0f, 1000.0f, 0.1f, 0.4f),
+        200.0f));
+
+    params.push_back (std::make_unique<AudioParameterFloat> (
+        AuricParams::parameterId (AuricParams::xoverHigh), "XOVER HI",
+        NormalisableRange<float> (1000.0f, 12000.0f, 1.0f, 0.4f),
+        2500.0f));
+
+    // detector / gain computer once per 4-8 samples, gain interpolated (automatic above 96 kHz)
+    params.push_back (std::make_unique<AudioParameterBool> (
+        AuricParams::parameterId (AuricParams::detEco), "DET ECO",
+        false));
+
+    // x1 drive anti-aliasing (ADAA2 adds 1 sample latency), own param so quality keeps its 4 choices
+    params.push_back (std::make_unique<AudioParameterChoice> (
+        AuricParams::parameterId (AuricParams::driveAa), "DRIVE AA",
+        StringArray { "OFF", "ADAA1", "ADAA2" },
+        0));
+
     return { params.begin(), params.end() };
 }
 //==============================================================================
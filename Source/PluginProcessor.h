@@ -2,8 +2,14 @@
 
 #include <JuceHeader.h>
 
+#include "AuricCompressorEngine.h"
+#include "AuricGainCurve.h"
+#include "AuricCpuGovernor.h"
+#include "AuricParams.h"
+
 //==============================================================================
-class AuricOmega76AudioProcessor  : public juce::AudioProcessor
+class AuricOmega76AudioProcessor  : public juce::AudioProcessor,
+                                    private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -19,6 +25,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -51,32 +59,68 @@ public:
     // meter for UI
     float getGainReductionDb() const noexcept { return grDb.load(); }
 
+    // oversampling factor actually running (1, 2, 4) — resolves "Ω Auto" for the UI
+    int getOversamplingFactor() const noexcept { return activeOsFactor.load(); }
+
+    // CPU governor (level, load, step log) — for the editor and post-show audits
+    const AuricCpuGovernor& getCpuGovernor() const noexcept { return governor; }
+    static juce::String describeGovernorLevel (int level);
+
+    // static compressor curve (same table the DSP uses) — editor transfer-curve display
+    const AuricGainCurve::Table* getGainCurve() const noexcept { return gainCurve.load (std::memory_order_acquire); }
+
 private:
     //==============================================================================
     std::atomic<float> grDb { 0.0f };
+    std::atomic<int> activeOsFactor { 1 };
 
     double sr { 44100.0 };
 
-    // sidechain HPF for detector (NO juce_dsp)
-    juce::IIRFilter scHpfL, scHpfR;
-    juce::IIRCoefficients scHpfCoeffs;
-
-    void updateSidechainHPF();
-
-    // envelope + gain smoothing
-    float env { 0.0f };
-    float gainLin { 1.0f };
+    // staged block kernel (detector, gain computer, drive, mix)
+    AuricCompressorEngine engine;
+
+    // raw parameter pointers, resolved once in the constructor
+    AuricParams paramTable;
+
+    // shared body of both processBlock overloads (float / double host buffers)
+    template <typename SampleType>
+    void processSamples (juce::AudioBuffer<SampleType>& buffer);
+    // outputs past the processed input: mono -> stereo copy, else cleared
+    template <typename SampleType>
+    static void fillExtraOutputs (juce::AudioBuffer<SampleType>& buffer, int numProcessed, int numOutputs);
+
+    // block-rate engine settings; the exp/pow-derived ones are only recomputed
+    // when their source parameter (or the sample rate) moves
+    AuricCompressorEngine::Settings settings;
+    AuricParams::Snapshot derivedFrom;
+    bool derivedValid { false };
+    void updateDerivedSettings (const AuricParams::Snapshot& p) noexcept;
+
+    // omegaMode -> shared gain table (built once per process), the one in use for the editor
+    std::atomic<const AuricGainCurve::Table*> gainCurve { &AuricGainCurve::forMode (0) };
+
+    // steps quality down under load; level 1/2 = one/two oversampling steps less,
+    // level 3 = cheapest saturator approximation + control-rate detector (gain computer) on top
+    AuricCpuGovernor governor;
+    static constexpr int governorMaxLevel = 3;
+
+    // latency follows the oversampling mode; host is told from the message thread
+    std::atomic<int> pendingLatency { 0 };
+    void handleAsyncUpdate() override;
+    void publishOversamplingState() noexcept;
+
+    // quality choice -> oversampling factor (log2) for the drive stage
+    int getOversamplingFactorLog2 (int qualityIndex) const noexcept;
+    // factor whose latency the host is told: Auto always reports the x4 a bounce switches
+    // to, live x2 / x1 is padded up to it (same PDC realtime and offline)
+    int getReportedFactorLog2 (int qualityIndex) const noexcept;
+    // drive_aa choice -> ADAA order (0 off, 1, 2), only where quality resolves to x1
+    int getAdaaOrder (int qualityIndex, int driveAaIndex) const noexcept;
+    // lookahead ms -> whole samples at the current rate (audio path delay, reported to the host)
+    int getLookaheadSamples (float ms) const noexcept;
 
     // helpers
     static inline float dbToLin (float db) noexcept { return std::pow (10.0f, db / 20.0f); }
-    static inline float linToDb (float lin) noexcept
-    {
-        return 20.0f * std::log10 (juce::jmax (lin, 1.0e-8f));
-    }
-
-    float getParam (const juce::String& id, float fallback) const noexcept;
-    int   getChoice (const juce::String& id, int fallback) const noexcept;
-    bool  getBool   (const juce::String& id, bool fallback) const noexcept;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AuricOmega76AudioProcessor)
 };
@@ -0,0 +1,119 @@
+//==============================================================================
+// AuricBlockSizeTests.cpp  (AURIC Ω76 tests) — host block size invariance
+//  - The engine runs fixed 64-sample sub-blocks on an absolute grid, so the
+//    output must not depend on how the host slices its buffers
+//  - Every config renders the same program once as one block (reference)
+//    and again in random host blocks of 1..4096 samples: must match exactly
+//  - Except where a mono / stereo SVF (SC filter, crossover) runs scattered
+//    look-ahead: its 4-sample groups start where each chunk starts, so a
+//    host cut moves them and float rounding (not the response) changes;
+//    those configs get -100 dB
+//  - Same random slicing through the double path: the float reference,
+//    widened, must come out (double I/O only converts at the edges)
+//==============================================================================
+
+#include "AuricTestHelpers.h"
+
+class AuricBlockSizeTests : public juce::UnitTest
+{
+public:
+    AuricBlockSizeTests() : juce::UnitTest ("Block size invariance", "Auric") {}
+
+    void runTest() override
+    {
+        // name, channels, sample rate, settings tweak, external key
+        check ("stereo, comp only", 2, 48000.0, [] (Engine::Settings& s) { s.routing = Engine::routingA; });
+        check ("stereo, x2 min-phase", 2, 48000.0, [] (Engine::Settings& s) { s.osFactorLog2 = 1; });
+        check ("stereo, x4 lin-phase + 2 ms lookahead", 2, 48000.0, [] (Engine::Settings& s)
+        {
+            s.osFactorLog2 = 2;
+            s.osPhase = AuricOversampler::linearPhase;
+            s.lookahead = 96;
+        });
+        check ("mono, drive only, ADAA2", 1, 48000.0, [] (Engine::Settings& s)
+        {
+            s.routing = Engine::routingD;
+            s.adaaOrder = 2;
+        });
+        check ("6 ch, RMS detector, SC tilt", 6, 48000.0, [] (Engine::Settings& s)
+        {
+            s.detMode = Engine::detRms;
+            s.rmsWindow = 480;
+            s.scHpf = true;
+            s.scShape = AuricSvf::tilt;
+            s.scFreq = 800.0f;
+        });
+        check ("stereo M/S, external key, SC HPF", 2, 48000.0, [] (Engine::Settings& s)
+        {
+            s.scMode = Engine::scDualMS;
+            s.scLink = 0.3f;
+            s.scHpf = true;
+        }, scatteredTolerance, true);
+        check ("stereo L/R, detector eco", 2, 48000.0, [] (Engine::Settings& s)
+        {
+            s.scMode = Engine::scDualLR;
+            s.detEco = true;
+        });
+        check ("stereo multiband + 1 ms lookahead", 2, 48000.0, [] (Engine::Settings& s)
+        {
+            s.multiband = true;
+            s.lookahead = 48;
+        }, scatteredTolerance);
+        check ("stereo 192 kHz (control-rate detector), P+R", 2, 192000.0, [] (Engine::Settings& s)
+        {
+            s.detMode = Engine::detHybrid;
+            s.rmsWindow = 1920;
+        });
+    }
+
+private:
+    using Engine = AuricCompressorEngine;
+
+    static constexpr double scatteredTolerance = 1.0e-5;
+
+    template <typename Tweak>
+    void check (const char* name, int numChannels, double sampleRate, Tweak&& tweak, double tolerance = 0.0,
+                bool withKey = false)
+    {
+        beginTest (name);
+
+        const int numSamples = juce::roundToInt (2.0 * sampleRate);
+        auto s = AuricTest::makeSettings (sampleRate);
+        tweak (s);
+
+        const auto program = AuricTest::makeProgram (numChannels, numSamples, sampleRate, 76);
+        const auto key = AuricTest::makeProgram (2, numSamples, sampleRate, 77);
+        const auto* keyPtr = withKey ? &key : nullptr;
+
+        Engine reference;
+        reference.prepare (sampleRate, numChannels);
+        auto expected = program;
+        AuricTest::render (reference, expected, s, [numSamples] { return numSamples; }, keyPtr);
+
+        auto random = getRandom();
+        const auto nextBlockSize = [&random]
+        {
+            // mostly tiny / odd sizes, now and then a large one
+            return random.nextInt (4) == 0 ? 1 + random.nextInt (4096) : 1 + random.nextInt (100);
+        };
+
+        Engine sliced;
+        sliced.prepare (sampleRate, numChannels);
+        auto actual = program;
+        AuricTest::render (sliced, actual, s, nextBlockSize, keyPtr);
+
+        const double diff = AuricTest::maxAbsDiff (expected, actual);
+        expectLessOrEqual (diff, tolerance, "float, random host blocks: max |diff| " + juce::String (diff));
+
+        Engine slicedDouble;
+        slicedDouble.prepare (sampleRate, numChannels);
+        auto actualDouble = AuricTest::convert<double> (program);
+        const auto keyDouble = AuricTest::convert<double> (key);
+        AuricTest::render (slicedDouble, actualDouble, s, nextBlockSize, withKey ? &keyDouble : nullptr);
+
+        const double diffDouble = AuricTest::maxAbsDiff (expected, actualDouble);
+        expectLessOrEqual (diffDouble, tolerance, "double, random host blocks: max |diff| " + juce::String (diffDouble));
+    }
+};
+
+static AuricBlockSizeTests auricBlockSizeTests;
@@ -0,0 +1,252 @@
+//==============================================================================
+// AuricKernelTests.cpp  (AURIC Ω76 tests) — chunk kernel throughput
+//  - Test: the mono kernel matches the stereo kernel fed L = R (dual mono),
+//    so a mono track loses nothing by skipping the phantom right channel
+//  - Bench: ns/sample of every routing x SC filter x layout kernel (the
+//    chunkKernels table), program material compressing, x1, 512-sample blocks
+//  - Bench: mono kernel against the same signal as dual-mono stereo
+//  - Bench: float host buffers, double host buffers straight into the engine,
+//    and double converted to float around it (what a wrapper does for a
+//    float-only plugin)
+//==============================================================================
+
+#include "AuricTestHelpers.h"
+
+namespace
+{
+    using Engine = AuricCompressorEngine;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int hostBlock = 512;
+
+    struct Layout
+    {
+        const char* name;
+        int numChannels;
+        int scMode;
+        bool multiband;
+    };
+
+    constexpr Layout layouts[] = {
+        { "mono",      1, Engine::scLinked, false },
+        { "stereo",    2, Engine::scLinked, false },
+        { "6 ch",      6, Engine::scLinked, false },
+        { "dual L/R",  2, Engine::scDualLR, false },
+        { "dual M/S",  2, Engine::scDualMS, false },
+        { "multiband", 2, Engine::scLinked, true },
+    };
+
+    const char* routingName (int r) { return r == Engine::routingA ? "A" : r == Engine::routingD ? "D" : "Ω"; }
+
+    // best-of-N ns per sample frame (all channels) of one engine over the program
+    template <typename SampleType>
+    double kernelNs (const AuricTest::Channels<SampleType>& program, const Engine::Settings& s, int blockSize,
+                     int numRuns = 10)
+    {
+        Engine engine;
+        engine.prepare (sampleRate, (int) program.size());
+
+        auto io = program;
+        return AuricTest::nsPerSample ([&]
+        {
+            io = program;
+            AuricTest::render (engine, io, s, [blockSize] { return blockSize; });
+        }, (int) program[0].size(), numRuns);
+    }
+}
+
+//==============================================================================
+class AuricKernelTests : public juce::UnitTest
+{
+public:
+    AuricKernelTests() : juce::UnitTest ("Kernel: mono vs dual mono", "Auric") {}
+
+    void runTest() override
+    {
+        for (int routing = 0; routing < Engine::numRoutings; ++routing)
+        {
+            for (bool scHpf : { false, true })
+            {
+                beginTest (juce::String ("routing ") + routingName (routing) + (scHpf ? ", SC HPF" : ""));
+
+                auto s = AuricTest::makeSettings (sampleRate);
+                s.routing = routing;
+                s.scHpf   = scHpf;
+
+                const auto mono = AuricTest::makeProgram (1, juce::roundToInt (sampleRate), sampleRate, 76);
+                AuricTest::Channels<float> dualMono { mono[0], mono[0] };
+
+                auto monoOut = mono;
+                Engine monoEngine;
+                monoEngine.prepare (sampleRate, 1);
+                AuricTest::render (monoEngine, monoOut, s, [] { return hostBlock; });
+
+                Engine stereoEngine;
+                stereoEngine.prepare (sampleRate, 2);
+                AuricTest::render (stereoEngine, dualMono, s, [] { return hostBlock; });
+
+                const double diff = juce::jmax (AuricTest::maxAbsDiff (monoOut, AuricTest::Channels<float> { dualMono[0] }),
+                                                AuricTest::maxAbsDiff (monoOut, AuricTest::Channels<float> { dualMono[1] }));
+                expectLessOrEqual (diff, 0.0, "mono vs dual mono: max |diff| " + juce::String (diff));
+            }
+        }
+    }
+};
+
+static AuricKernelTests auricKernelTests;
+
+//==============================================================================
+class AuricKernelBench : public juce::UnitTest
+{
+public:
+    AuricKernelBench() : juce::UnitTest ("Kernel: ns/sample per configuration", "Auric Bench") {}
+
+    void runTest() override
+    {
+        beginTest ("routing x SC HPF x layout, 48 kHz, x1, 512-sample blocks");
+
+        const int numSamples = juce::roundToInt (sampleRate);
+        AuricTest::Channels<float> programs[6];
+        for (size_t i = 0; i < std::size (layouts); ++i)
+            programs[i] = AuricTest::makeProgram (layouts[i].numChannels, numSamples, sampleRate, 0x4f76);
+
+        juce::String header ("         ");
+        for (const auto& l : layouts)
+            header += juce::String (l.name).paddedRight (' ', 11);
+        logMessage (header);
+
+        for (int routing = 0; routing < Engine::numRoutings; ++routing)
+        {
+            for (bool scHpf : { false, true })
+            {
+                juce::String row ((juce::String (routingName (routing)) + (scHpf ? " hpf" : "")).paddedRight (' ', 9));
+
+                for (size_t i = 0; i < std::size (layouts); ++i)
+                {
+                    auto s = AuricTest::makeSettings (sampleRate);
+                    s.routing   = routing;
+                    s.scHpf     = scHpf;
+                    s.scMode    = layouts[i].scMode;
+                    s.scLink    = 0.3f;
+                    s.multiband = layouts[i].multiband;
+
+                    row += juce::String (kernelNs (programs[i], s, hostBlock), 1).paddedRight (' ', 11);
+                }
+
+                logMessage (row);
+            }
+        }
+
+        logMessage ("(ns per sample frame, all channels)");
+    }
+};
+
+static AuricKernelBench auricKernelBench;
+
+//==============================================================================
+class AuricMonoBench : public juce::UnitTest
+{
+public:
+    AuricMonoBench() : juce::UnitTest ("Kernel: mono vs dual-mono stereo", "Auric Bench") {}
+
+    void runTest() override
+    {
+        beginTest ("same signal on a mono bus vs L = R on a stereo bus, 48 kHz, 512-sample blocks");
+
+        const auto mono = AuricTest::makeProgram (1, juce::roundToInt (sampleRate), sampleRate, 0x4f76);
+        const AuricTest::Channels<float> dualMono { mono[0], mono[0] };
+
+        for (int osFactorLog2 : { 0, 1 })
+        {
+            for (int routing = 0; routing < Engine::numRoutings; ++routing)
+            {
+                for (bool scHpf : { false, true })
+                {
+                    auto s = AuricTest::makeSettings (sampleRate);
+                    s.routing      = routing;
+                    s.scHpf        = scHpf;
+                    s.osFactorLog2 = osFactorLog2;
+
+                    const double stereoNs = kernelNs (dualMono, s, hostBlock);
+                    const double monoNs   = kernelNs (mono, s, hostBlock);
+
+                    logMessage (juce::String (routingName (routing)) + (scHpf ? " hpf" : "    ")
+                                + (osFactorLog2 > 0 ? " x2: " : " x1: ") + juce::String (stereoNs, 1) + " -> "
+                                + juce::String (monoNs, 1) + " ns/sample (" + juce::String (stereoNs / monoNs, 2) + "x)");
+                }
+            }
+        }
+    }
+};
+
+static AuricMonoBench auricMonoBench;
+
+//==============================================================================
+class AuricPrecisionBench : public juce::UnitTest
+{
+public:
+    AuricPrecisionBench() : juce::UnitTest ("Kernel: float vs double host buffers", "Auric Bench") {}
+
+    void runTest() override
+    {
+        beginTest ("stereo, routing Ω, x2, SC HPF, 48 kHz");
+
+        const auto program = AuricTest::makeProgram (2, juce::roundToInt (sampleRate), sampleRate, 0x4f76);
+        const auto programDouble = AuricTest::convert<double> (program);
+
+        auto s = AuricTest::makeSettings (sampleRate);
+        s.osFactorLog2 = 1;
+        s.scHpf = true;
+
+        for (int blockSize : { 64, 512, 4096 })
+        {
+            const double floatNs  = kernelNs (program, s, blockSize);
+            const double doubleNs = kernelNs (programDouble, s, blockSize);
+            const double wrapperNs = wrappedDoubleNs (programDouble, s, blockSize);
+
+            logMessage ("host " + juce::String (blockSize) + ": float " + juce::String (floatNs, 1)
+                        + ", double " + juce::String (doubleNs, 1)
+                        + ", double via float copy " + juce::String (wrapperNs, 1) + " ns/sample");
+        }
+    }
+
+private:
+    // double host buffer -> float copy of the whole block -> engine -> back
+    double wrappedDoubleNs (const AuricTest::Channels<double>& program, const Engine::Settings& s, int blockSize)
+    {
+        const int numChannels = (int) program.size();
+        const int numSamples = (int) program[0].size();
+
+        Engine engine;
+        engine.prepare (sampleRate, numChannels);
+
+        auto io = program;
+        AuricTest::Channels<float> shadow ((size_t) numChannels, std::vector<float> ((size_t) blockSize));
+        float* ptrs[Engine::maxChannels] {};
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            ptrs[ch] = shadow[(size_t) ch].data();
+
+        return AuricTest::nsPerSample ([&]
+        {
+            io = program;
+
+            for (int pos = 0; pos < numSamples; pos += blockSize)
+            {
+                const int n = juce::jmin (blockSize, numSamples - pos);
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    for (int i = 0; i < n; ++i)
+                        ptrs[ch][i] = (float) io[(size_t) ch][(size_t) (pos + i)];
+
+                engine.process (ptrs, numChannels, n, s);
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    for (int i = 0; i < n; ++i)
+                        io[(size_t) ch][(size_t) (pos + i)] = (double) ptrs[ch][i];
+            }
+        }, numSamples, 10);
+    }
+};
+
+static AuricPrecisionBench auricPrecisionBench;
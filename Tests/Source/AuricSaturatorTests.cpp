@@ -0,0 +1,138 @@
+//==============================================================================
+// AuricSaturatorTests.cpp  (AURIC Ω76 tests) — atan approximations
+//  - Test: max |err| vs std::atan on the whole line stays inside the figure
+//    the header documents, the |x| = 1 fold is continuous, odd symmetry
+//  - Bench: error report + ns/sample of each approximation vs std::atan
+//==============================================================================
+
+#include "AuricTestHelpers.h"
+
+#include "../../Source/AuricSaturator.h"
+
+namespace
+{
+    struct Approx
+    {
+        int id;
+        const char* name;
+        double documentedMaxErr;   // AuricSaturator.h table
+    };
+
+    constexpr Approx approximations[] = {
+        { AuricSaturator::atanPoly3,  "atanPoly3",  6.13e-3 },
+        { AuricSaturator::atanPoly5,  "atanPoly5",  7.04e-4 },
+        { AuricSaturator::atanPoly7,  "atanPoly7",  9.09e-5 },
+        { AuricSaturator::atanPoly11, "atanPoly11", 1.94e-6 },
+        { AuricSaturator::atanLut256, "atanLut256", 1.40e-6 },
+    };
+
+    float shapeOne (float x, int approx) noexcept
+    {
+        AuricSaturator::shape (&x, 1, approx);
+        return x;
+    }
+
+    // [0, 1] linearly, then 1 .. 1e6 geometrically (the folded side)
+    double maxErrorOnLine (int approx, int pointsPerSide)
+    {
+        double worst = 0.0;
+
+        for (int i = 0; i <= 2 * pointsPerSide; ++i)
+        {
+            const float x = i <= pointsPerSide
+                              ? (float) i / (float) pointsPerSide
+                              : std::pow (10.0f, 6.0f * (float) (i - pointsPerSide) / (float) pointsPerSide);
+
+            worst = juce::jmax (worst, std::abs ((double) shapeOne (x, approx) - std::atan ((double) x)));
+        }
+
+        return worst;
+    }
+
+    // step across |x| = 1 beyond what std::atan itself does over that one ulp
+    double foldJump (int approx)
+    {
+        const float below = std::nextafter (1.0f, 0.0f);
+        const float above = std::nextafter (1.0f, 2.0f);
+
+        return std::abs ((double) shapeOne (above, approx) - (double) shapeOne (below, approx)
+                         - (std::atan ((double) above) - std::atan ((double) below)));
+    }
+}
+
+//==============================================================================
+class AuricSaturatorTests : public juce::UnitTest
+{
+public:
+    AuricSaturatorTests() : juce::UnitTest ("Saturator atan", "Auric") {}
+
+    void runTest() override
+    {
+        for (const auto& a : approximations)
+        {
+            beginTest (a.name);
+
+            // documented figures are rounded to 3 digits
+            const double err = maxErrorOnLine (a.id, 200000);
+            expectLessOrEqual (err, a.documentedMaxErr * 1.005, "max |err| " + juce::String (err));
+
+            // an unpinned endpoint jumps by 2 * its error here (1e-2 for order 3)
+            const double jump = foldJump (a.id);
+            expectLessOrEqual (jump, 1.0e-6, "fold jump " + juce::String (jump));
+
+            auto random = getRandom();
+
+            for (int i = 0; i < 1000; ++i)
+            {
+                const float x = 20.0f * (random.nextFloat() - 0.5f);
+                expectEquals (shapeOne (-x, a.id), -shapeOne (x, a.id), "odd symmetry");
+            }
+        }
+    }
+};
+
+static AuricSaturatorTests auricSaturatorTests;
+
+//==============================================================================
+class AuricSaturatorBench : public juce::UnitTest
+{
+public:
+    AuricSaturatorBench() : juce::UnitTest ("Saturator atan: error + cost", "Auric Bench") {}
+
+    void runTest() override
+    {
+        beginTest ("error report + ns/sample (64k samples, drive range +-8)");
+
+        constexpr int numSamples = 1 << 16;
+        std::vector<float> input ((size_t) numSamples), work ((size_t) numSamples);
+
+        auto random = getRandom();
+        for (auto& x : input)
+            x = 16.0f * (random.nextFloat() - 0.5f);
+
+        const auto timeOf = [&] (int approx)
+        {
+            return AuricTest::nsPerSample ([&]
+            {
+                std::copy (input.begin(), input.end(), work.begin());
+                AuricSaturator::shape (work.data(), numSamples, approx);
+            }, numSamples);
+        };
+
+        const double exactNs = timeOf (AuricSaturator::atanExact);
+        logMessage ("std::atan     " + juce::String (exactNs, 2) + " ns/sample");
+
+        for (const auto& a : approximations)
+        {
+            const double ns = timeOf (a.id);
+            const double err = maxErrorOnLine (a.id, 1000000);
+
+            logMessage (juce::String (a.name) + "  max |err| " + juce::String (err, 2, true)
+                        + " (" + juce::String (20.0 * std::log10 (err), 1) + " dB), fold jump "
+                        + juce::String (foldJump (a.id), 1, true) + ", "
+                        + juce::String (ns, 2) + " ns/sample, x" + juce::String (exactNs / ns, 1) + " vs std::atan");
+        }
+    }
+};
+
+static AuricSaturatorBench auricSaturatorBench;
@@ -0,0 +1,205 @@
+//==============================================================================
+// AuricSvfTests.cpp  (AURIC Ω76 tests) — SC filter, scattered look-ahead
+//  - Settled mono / stereo run 4 samples of one channel per SIMD step; the
+//    block matrices must reproduce the plain per-sample recursion
+//  - Test: scattered output vs a double-precision TPT SVF stepped one sample
+//    at a time (all SC shapes, random chunk sizes), and vs the channel-lane
+//    path of the same class (3 channels = no scattering)
+//  - Bench: ns per sample frame at 32..1024-sample chunks, scattered mono /
+//    stereo vs the channel-lane path they used before (one register)
+//==============================================================================
+
+#include "AuricTestHelpers.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int maxChunk = 1024;
+
+    // one sample at a time, in double: the recursion the block form has to match
+    struct ReferenceSvf
+    {
+        ReferenceSvf (float cutoffHz, int shape)
+        {
+            const double k = juce::MathConstants<double>::sqrt2;
+            const double A = std::pow (10.0, 12.0 / 40.0);
+            g = std::tan (juce::MathConstants<double>::pi * juce::jlimit (10.0, 0.45 * sampleRate, (double) cutoffHz) / sampleRate);
+
+            if (shape == AuricSvf::highPass)  { m0 = 1.0; m1 = -k;            m2 = -1.0; }
+            if (shape == AuricSvf::bandPass)  { m0 = 0.0; m1 = k;             m2 = 0.0; }
+            if (shape == AuricSvf::tilt)      { m0 = A;   m1 = k * (1.0 - A); m2 = (1.0 - A * A) / A; g *= std::sqrt (A); }
+
+            a1 = 1.0 / (1.0 + g * (g + k));
+            a2 = g * a1;
+            a3 = g * a2;
+        }
+
+        double process (double x) noexcept
+        {
+            const double v3 = x - s2;
+            const double v1 = a1 * s1 + a2 * v3;
+            const double v2 = s2 + a2 * s1 + a3 * v3;
+            s1 = 2.0 * v1 - s1;
+            s2 = 2.0 * v2 - s2;
+            return m0 * x + m1 * v1 + m2 * v2;
+        }
+
+        double g, a1, a2, a3, m0 = 1.0, m1 = 0.0, m2 = 0.0;
+        double s1 = 0.0, s2 = 0.0;
+    };
+
+    AuricTest::Channels<float> makeNoise (int numChannels, int numSamples, juce::int64 seed)
+    {
+        juce::Random rng (seed);
+        AuricTest::Channels<float> out ((size_t) numChannels, std::vector<float> ((size_t) numSamples));
+
+        for (auto& x : out)
+            for (auto& v : x)
+                v = 0.5f * (2.0f * rng.nextFloat() - 1.0f);
+
+        return out;
+    }
+
+    // settled on (cutoffHz, shape) from the first sample
+    void prepareSettled (AuricSvf& svf, float cutoffHz, int shape)
+    {
+        svf.prepare (sampleRate, maxChunk);
+        svf.setTarget (cutoffHz, shape);
+        svf.reset();
+    }
+
+    // whole signal through svf into out (same shape as in), chunk sizes from nextChunk()
+    template <typename ChunkFn>
+    void filterInto (AuricSvf& svf, const AuricTest::Channels<float>& in, AuricTest::Channels<float>& out,
+                     ChunkFn&& nextChunk)
+    {
+        const int numChannels = (int) in.size();
+        const int numSamples = (int) in[0].size();
+        const float* inPtrs[AuricSvf::maxChannels] {};
+        float* outPtrs[AuricSvf::maxChannels] {};
+
+        for (int pos = 0; pos < numSamples;)
+        {
+            const int n = juce::jmin (nextChunk(), numSamples - pos);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                inPtrs[ch] = in[(size_t) ch].data() + pos;
+                outPtrs[ch] = out[(size_t) ch].data() + pos;
+            }
+
+            svf.process (inPtrs, outPtrs, numChannels, n);
+            pos += n;
+        }
+    }
+
+    template <typename ChunkFn>
+    AuricTest::Channels<float> filter (AuricSvf& svf, const AuricTest::Channels<float>& in, ChunkFn&& nextChunk)
+    {
+        auto out = in;
+        filterInto (svf, in, out, nextChunk);
+        return out;
+    }
+}
+
+//==============================================================================
+class AuricSvfTests : public juce::UnitTest
+{
+public:
+    AuricSvfTests() : juce::UnitTest ("SC filter: scattered look-ahead", "Auric") {}
+
+    void runTest() override
+    {
+        const char* shapeNames[] = { "HPF", "band-pass", "tilt" };
+
+        for (int shape : { AuricSvf::highPass, AuricSvf::bandPass, AuricSvf::tilt })
+        {
+            for (float cutoff : { 20.0f, 120.0f, 2000.0f, 15000.0f })
+            {
+                beginTest (juce::String (shapeNames[shape]) + " at " + juce::String (cutoff, 0) + " Hz");
+
+                const auto noise = makeNoise (2, 1 << 18, 22);
+                auto random = getRandom();
+                const auto nextChunk = [&random] { return 1 + random.nextInt (maxChunk); };
+
+                // the per-sample recursion, exact
+                AuricTest::Channels<double> reference (2, std::vector<double> (noise[0].size()));
+                for (size_t ch = 0; ch < 2; ++ch)
+                {
+                    ReferenceSvf ref (cutoff, shape);
+                    for (size_t n = 0; n < noise[ch].size(); ++n)
+                        reference[ch][n] = ref.process ((double) noise[ch][n]);
+                }
+
+                AuricSvf mono, stereo, lanes;
+                prepareSettled (mono, cutoff, shape);
+                prepareSettled (stereo, cutoff, shape);
+                prepareSettled (lanes, cutoff, shape);
+
+                const auto monoOut = filter (mono, AuricTest::Channels<float> { noise[0] }, nextChunk);
+                const auto stereoOut = filter (stereo, noise, nextChunk);
+                // third channel: three lanes busy, the channel-lane (per-sample) path
+                const auto lanesOut = filter (lanes, AuricTest::Channels<float> { noise[0], noise[1], noise[0] }, nextChunk);
+
+                const double monoErr = AuricTest::maxAbsDiff (monoOut, AuricTest::Channels<double> { reference[0] });
+                const double stereoErr = AuricTest::maxAbsDiff (stereoOut, reference);
+                const double lanesErr = AuricTest::maxAbsDiff (AuricTest::Channels<float> { lanesOut[0], lanesOut[1] }, reference);
+                const double vsLanes = AuricTest::maxAbsDiff (stereoOut, AuricTest::Channels<float> { lanesOut[0], lanesOut[1] });
+
+                // float rounding only (a wrong block matrix is off by orders of magnitude)
+                expectLessOrEqual (monoErr, 2.0e-6, "mono vs double recursion: max |err| " + juce::String (monoErr));
+                expectLessOrEqual (stereoErr, 2.0e-6, "stereo vs double recursion: max |err| " + juce::String (stereoErr));
+                expectLessOrEqual (vsLanes, 2.0 * juce::jmax (lanesErr, 1.0e-6),
+                                   "stereo vs channel lanes: max |diff| " + juce::String (vsLanes));
+            }
+        }
+    }
+};
+
+static AuricSvfTests auricSvfTests;
+
+//==============================================================================
+class AuricSvfBench : public juce::UnitTest
+{
+public:
+    AuricSvfBench() : juce::UnitTest ("SC filter: scattered vs channel lanes", "Auric Bench") {}
+
+    void runTest() override
+    {
+        beginTest ("settled HPF 120 Hz, ns per sample frame");
+
+        const int numSamples = 1 << 16;
+        const auto noise = makeNoise (3, numSamples, 22);
+        const AuricTest::Channels<float> monoIn { noise[0] };
+        const AuricTest::Channels<float> stereoIn { noise[0], noise[1] };
+
+        juce::String header ("chunk            "), monoRow ("mono, scattered  "), stereoRow ("stereo, scattered"),
+                     lanesRow ("channel lanes    ");
+
+        for (int chunk : { 32, 64, 128, 256, 512, 1024 })
+        {
+            header    += " " + juce::String (chunk).paddedRight (' ', 7);
+            monoRow   += " " + juce::String (timeOf (monoIn, chunk), 2).paddedRight (' ', 7);
+            stereoRow += " " + juce::String (timeOf (stereoIn, chunk), 2).paddedRight (' ', 7);
+            lanesRow  += " " + juce::String (timeOf (noise, chunk), 2).paddedRight (' ', 7);
+        }
+
+        logMessage (header);
+        logMessage (monoRow);
+        logMessage (stereoRow);
+        logMessage (lanesRow + "  (3 ch, one register: what mono / stereo cost before)");
+    }
+
+private:
+    static double timeOf (const AuricTest::Channels<float>& in, int chunk)
+    {
+        AuricSvf svf;
+        prepareSettled (svf, 120.0f, AuricSvf::highPass);
+
+        auto out = in;
+        return AuricTest::nsPerSample ([&] { filterInto (svf, in, out, [chunk] { return chunk; }); },
+                                       (int) in[0].size());
+    }
+};
+
+static AuricSvfBench auricSvfBench;
@@ -0,0 +1,191 @@
+//==============================================================================
+// AuricSwitchTests.cpp  (AURIC Ω76 tests) — mode switches keep the signal
+//  - Dry only (mix 0): the output stays the trimmed input at the fixed
+//    latency through every drive change (oversampling, phase, ADAA), bit for
+//    bit: the drive crossfades, the dry path is never touched
+//  - Steady sine through Ω: no 32-sample window around a drive step,
+//    lookahead change or band split toggle drops below half the quietest
+//    steady window (a fade through silence did, ~10 ms per switch)
+//  - The same switch program in random host blocks matches fixed 512-sample
+//    blocks: every switch starts on the sub-block grid (blocks stay under the
+//    20 ms parameter ramp, so the drive norm glide doesn't follow the slicing)
+//==============================================================================
+
+#include "AuricTestHelpers.h"
+
+namespace
+{
+    using Engine = AuricCompressorEngine;
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int segmentLength = 4800;   // 100 ms per setting, a multiple of the sub-block
+
+    // settings per segment: each one a switch against the one before
+    std::vector<Engine::Settings> makeSwitchProgram (const Engine& engine, bool withLatencyChanges)
+    {
+        auto base = AuricTest::makeSettings (sampleRate);
+        base.osFactorLog2 = 2;
+
+        // like the processor: Auto reports x4, the governor steps under it
+        const int floor = engine.getLatencySamplesFor (2, AuricOversampler::minimumPhase);
+        base.latencyFloor = floor;
+
+        std::vector<Engine::Settings> program;
+        const auto add = [&program, &base] (auto&& tweak)
+        {
+            auto s = base;
+            tweak (s);
+            program.push_back (s);
+            base = s;
+        };
+
+        add ([] (Engine::Settings&) {});
+        add ([] (Engine::Settings& s) { s.osFactorLog2 = 1; });
+        add ([] (Engine::Settings& s) { s.osFactorLog2 = 0; });
+        add ([] (Engine::Settings& s) { s.adaaOrder = 2; });
+        add ([] (Engine::Settings& s) { s.adaaOrder = 1; });
+        add ([] (Engine::Settings& s) { s.adaaOrder = 0; s.osFactorLog2 = 2; });
+
+        if (withLatencyChanges)
+        {
+            // lookahead + the reported latency move together (tap ramps), then the split
+            add ([floor] (Engine::Settings& s) { s.lookahead = 48; s.latencyFloor = floor + 48; });
+            add ([] (Engine::Settings& s) { s.multiband = true; });
+            add ([] (Engine::Settings& s) { s.osFactorLog2 = 1; });
+            add ([] (Engine::Settings& s) { s.multiband = false; });
+            add ([floor] (Engine::Settings& s) { s.lookahead = 0; s.latencyFloor = floor; });
+        }
+
+        return program;
+    }
+
+    // one segment per setting; host blocks never straddle a change
+    template <typename BlockSizeFn>
+    void renderProgram (Engine& engine, AuricTest::Channels<float>& io, const std::vector<Engine::Settings>& program,
+                        BlockSizeFn&& nextBlockSize)
+    {
+        const int numChannels = (int) io.size();
+        float* ptrs[Engine::maxChannels] {};
+
+        for (size_t seg = 0; seg < program.size(); ++seg)
+        {
+            const int end = (int) (seg + 1) * segmentLength;
+
+            for (int pos = (int) seg * segmentLength; pos < end;)
+            {
+                const int blockSize = juce::jmin (juce::jmax (1, nextBlockSize()), end - pos);
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    ptrs[ch] = io[(size_t) ch].data() + pos;
+
+                engine.process (ptrs, numChannels, blockSize, program[seg]);
+                pos += blockSize;
+            }
+        }
+    }
+
+    AuricTest::Channels<float> makeSine (int numChannels, int numSamples)
+    {
+        AuricTest::Channels<float> x ((size_t) numChannels, std::vector<float> ((size_t) numSamples));
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int n = 0; n < numSamples; ++n)
+                x[(size_t) ch][(size_t) n] = (float) (0.5 * std::sin (juce::MathConstants<double>::twoPi * 1500.0
+                                                                      * n / sampleRate + 0.3 * ch));
+
+        return x;
+    }
+}
+
+//==============================================================================
+class AuricSwitchTests : public juce::UnitTest
+{
+public:
+    AuricSwitchTests() : juce::UnitTest ("Mode switches", "Auric") {}
+
+    void runTest() override
+    {
+        beginTest ("dry only: drive switches leave the dry untouched");
+        {
+            Engine engine;
+            engine.prepare (sampleRate, 2);
+
+            auto program = makeSwitchProgram (engine, false);
+            for (auto& s : program)
+                s.mix = 0.0f;
+
+            const int numSamples = (int) program.size() * segmentLength;
+            const auto input = AuricTest::makeProgram (2, numSamples, sampleRate, 76);
+            auto io = input;
+            renderProgram (engine, io, program, [] { return 512; });
+
+            const int latency = program[0].latencyFloor;
+            double worst = 0.0;
+
+            for (size_t ch = 0; ch < io.size(); ++ch)
+                for (int n = latency; n < numSamples; ++n)
+                    worst = juce::jmax (worst, std::abs ((double) io[ch][(size_t) n]
+                                                         - program[0].inGain * (double) input[ch][(size_t) (n - latency)]));
+
+            expectLessOrEqual (worst, 1.0e-6, "max |out - trimmed input| " + juce::String (worst));
+        }
+
+        beginTest ("Ω: no gap at any switch");
+        {
+            Engine engine;
+            engine.prepare (sampleRate, 2);
+
+            const auto program = makeSwitchProgram (engine, true);
+            const int numSamples = (int) program.size() * segmentLength;
+            auto io = makeSine (2, numSamples);
+            renderProgram (engine, io, program, [] { return 512; });
+
+            // RMS over whole periods (1.5 kHz = 32 samples) after the first segment (attack settled)
+            constexpr int window = 32;
+            double lowest = 1.0e9, lowestSteady = 1.0e9;
+
+            for (int start = segmentLength; start + window <= numSamples; start += window)
+            {
+                double sum = 0.0;
+
+                for (size_t ch = 0; ch < io.size(); ++ch)
+                    for (int n = start; n < start + window; ++n)
+                        sum += (double) io[ch][(size_t) n] * io[ch][(size_t) n];
+
+                const double rms = std::sqrt (sum / (double) (window * (int) io.size()));
+                lowest = juce::jmin (lowest, rms);
+
+                // steady: the second half of a segment, every switch long done
+                if (start % segmentLength >= segmentLength / 2)
+                    lowestSteady = juce::jmin (lowestSteady, rms);
+            }
+
+            logMessage ("  lowest window " + juce::String (20.0 * std::log10 (lowest), 2)
+                        + " dB, lowest steady " + juce::String (20.0 * std::log10 (lowestSteady), 2) + " dB");
+            expectGreaterOrEqual (lowest, 0.5 * lowestSteady, "a switch dips the output by more than 6 dB");
+        }
+
+        beginTest ("switch program: random host blocks match");
+        {
+            Engine reference;
+            reference.prepare (sampleRate, 2);
+            const auto program = makeSwitchProgram (reference, true);
+            const int numSamples = (int) program.size() * segmentLength;
+
+            auto expected = AuricTest::makeProgram (2, numSamples, sampleRate, 78);
+            auto actual = expected;
+            renderProgram (reference, expected, program, [] { return 512; });
+
+            auto random = getRandom();
+            Engine sliced;
+            sliced.prepare (sampleRate, 2);
+            renderProgram (sliced, actual, program, [&random] { return 1 + random.nextInt (300); });
+
+            // the split runs a scattered stereo SVF (see AuricBlockSizeTests)
+            const double diff = AuricTest::maxAbsDiff (expected, actual);
+            expectLessOrEqual (diff, 1.0e-5, "max |diff| " + juce::String (diff));
+        }
+    }
+};
+
+static AuricSwitchTests auricSwitchTests;
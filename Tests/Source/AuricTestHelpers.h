@@ -0,0 +1,144 @@
+//==============================================================================
+// AuricTestHelpers.h  (AURIC Ω76 tests) — shared test signals + render loops
+//  - Program material: drum-ish bursts over a sine pair and a noise floor,
+//    decorrelated per channel, quiet stretches in between: attack, release
+//    and the idle shortcut all get exercised
+//  - Renders run the engine in place, host block sizes from a callback
+//  - Benches: best-of-N wall clock per sample (the minimum filters out
+//    preemption / frequency ramps better than the mean)
+//==============================================================================
+
+#pragma once
+#include <JuceHeader.h>
+
+#include "../../Source/AuricCompressorEngine.h"
+
+#include <vector>
+
+namespace AuricTest
+{
+    template <typename SampleType>
+    using Channels = std::vector<std::vector<SampleType>>;
+
+    inline float leakFor (double seconds, double sampleRate) noexcept
+    {
+        return (float) (1.0 - std::exp (-1.0 / (seconds * sampleRate)));
+    }
+
+    // IRON curve, 1 ms attack / 80 ms release, Ω routing at unity drive
+    inline AuricCompressorEngine::Settings makeSettings (double sampleRate)
+    {
+        AuricCompressorEngine::Settings s;
+        s.curve     = &AuricGainCurve::forMode (1);
+        s.omegaMode = 1;
+        s.inGain    = 2.0f;
+        s.atkLeak   = leakFor (0.001, sampleRate);
+        s.relLeak   = leakFor (0.080, sampleRate);
+        s.driveBase = 1.5f;
+        s.hard      = 1.4f;
+        s.mix       = 0.85f;
+        s.omegaMix  = 0.7f;
+        s.routing   = AuricCompressorEngine::routingOmega;
+        return s;
+    }
+
+    inline Channels<float> makeProgram (int numChannels, int numSamples, double sampleRate, juce::int64 seed)
+    {
+        juce::Random rng (seed);
+        Channels<float> out ((size_t) numChannels, std::vector<float> ((size_t) numSamples));
+
+        const double twoPi = juce::MathConstants<double>::twoPi;
+        const int beat = juce::roundToInt (0.25 * sampleRate);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& x = out[(size_t) ch];
+            const double detune = 1.0 + 0.01 * ch;
+
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const double t = n / sampleRate;
+                const double hitEnv = std::exp (-(double) (n % beat) / (0.03 * sampleRate));
+                const double hit = hitEnv * std::sin (twoPi * 60.0 * detune * t * (1.0 + hitEnv));
+
+                // second half of every other bar drops to -60 dB: release / idle paths
+                const bool quiet = (n / (4 * beat)) % 2 == 1 && (n % (4 * beat)) >= 2 * beat;
+                const double level = quiet ? 0.001 : 1.0;
+
+                x[(size_t) n] = (float) (level * (0.6 * hit
+                                                  + 0.2 * std::sin (twoPi * 220.0 * detune * t)
+                                                  + 0.1 * std::sin (twoPi * 3100.0 * t))
+                                         + 0.02 * (rng.nextFloat() * 2.0f - 1.0f));
+            }
+        }
+
+        return out;
+    }
+
+    template <typename To, typename From>
+    Channels<To> convert (const Channels<From>& in)
+    {
+        Channels<To> out (in.size());
+
+        for (size_t ch = 0; ch < in.size(); ++ch)
+            out[ch].assign (in[ch].begin(), in[ch].end());
+
+        return out;
+    }
+
+    // in place; nextBlockSize() gives each host block (clipped to what is left)
+    template <typename SampleType, typename BlockSizeFn>
+    void render (AuricCompressorEngine& engine, Channels<SampleType>& io, const AuricCompressorEngine::Settings& s,
+                 BlockSizeFn&& nextBlockSize, const Channels<SampleType>* key = nullptr)
+    {
+        const int numChannels = (int) io.size();
+        const int numKey = key != nullptr ? (int) key->size() : 0;
+        const int numSamples = (int) io[0].size();
+
+        SampleType* ptrs[AuricCompressorEngine::maxChannels] {};
+        const SampleType* keyPtrs[AuricCompressorEngine::maxKeyChannels] {};
+
+        for (int pos = 0; pos < numSamples;)
+        {
+            const int blockSize = juce::jmin (juce::jmax (1, nextBlockSize()), numSamples - pos);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                ptrs[ch] = io[(size_t) ch].data() + pos;
+
+            for (int ch = 0; ch < numKey; ++ch)
+                keyPtrs[ch] = (*key)[(size_t) ch].data() + pos;
+
+            engine.process (ptrs, numChannels, blockSize, s, numKey > 0 ? keyPtrs : nullptr, numKey);
+            pos += blockSize;
+        }
+    }
+
+    // ns per sample of fn(), best of numRuns
+    template <typename Fn>
+    double nsPerSample (Fn&& fn, int samplesPerRun, int numRuns = 20)
+    {
+        double best = 1.0e30;
+
+        for (int run = 0; run < numRuns; ++run)
+        {
+            const auto start = juce::Time::getHighResolutionTicks();
+            fn();
+            const auto ticks = juce::Time::getHighResolutionTicks() - start;
+            best = juce::jmin (best, juce::Time::highResolutionTicksToSeconds (ticks));
+        }
+
+        return best * 1.0e9 / (double) samplesPerRun;
+    }
+
+    template <typename A, typename B>
+    double maxAbsDiff (const Channels<A>& a, const Channels<B>& b)
+    {
+        double worst = 0.0;
+
+        for (size_t ch = 0; ch < a.size(); ++ch)
+            for (size_t n = 0; n < a[ch].size(); ++n)
+                worst = juce::jmax (worst, std::abs ((double) a[ch][n] - (double) b[ch][n]));
+
+        return worst;
+    }
+}
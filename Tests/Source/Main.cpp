@@ -0,0 +1,31 @@
+//==============================================================================
+// Main.cpp  (AURIC Ω76 tests) — console runner for the engine tests
+//  - no argument: the "Auric" tests (correctness, exit code 1 on a failure)
+//  - --bench: the "Auric Bench" measurements (timings, error reports)
+//  - --all: both
+//==============================================================================
+
+#include <JuceHeader.h>
+
+int main (int argc, char* argv[])
+{
+    const juce::String mode (argc > 1 ? argv[1] : "");
+
+    // fixed seed: a failure reproduces on the next run
+    constexpr juce::int64 seed = 0x4f76;
+
+    juce::UnitTestRunner runner;
+
+    if (mode == "--bench" || mode == "--all")
+        runner.runTestsInCategory ("Auric Bench", seed);
+
+    if (mode != "--bench")
+        runner.runTestsInCategory ("Auric", seed);
+
+    int failures = 0;
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult (i)->failures;
+
+    return failures > 0 ? 1 : 0;
+}